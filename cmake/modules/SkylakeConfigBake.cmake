@@ -0,0 +1,66 @@
+#
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025 Balan Narcis (balannarcis96@gmail.com)
+#
+include_guard()
+
+#
+# Bake a json config into a generated header at build time
+#
+#   skl_config_bake(
+#       TARGET     <target>         # Target that embeds the baked config
+#       SCHEMA     <schema.cpp>     # Source defining the ConfigNode<T> loader and SKL_CONFIG_BAKE(T, loader)
+#       JSON       <config.json>    # Config to bake
+#       [NAME       <symbol>]       # Symbol/header name, defaults to the json file name
+#       [OUTPUT_DIR <dir>]          # Defaults to ${CMAKE_CURRENT_BINARY_DIR}/skl_config_baked
+#       [SOURCES    <files>...])    # Extra sources needed by the schema
+#
+# The json is loaded and validated by the schema's ConfigNode<T>, an invalid config fails the build.
+# The target can then `#include "<NAME>.hpp"` and call `loader.load_snapshot(skl_config_baked::<NAME>, config)`.
+#
+function( skl_config_bake )
+
+    cmake_parse_arguments(_BAKE "" "TARGET;SCHEMA;JSON;NAME;OUTPUT_DIR" "SOURCES" ${ARGN})
+
+    if(NOT _BAKE_TARGET OR NOT _BAKE_SCHEMA OR NOT _BAKE_JSON)
+        message(FATAL_ERROR "skl_config_bake requires TARGET, SCHEMA and JSON!")
+    endif()
+
+    if(NOT TARGET ${_BAKE_TARGET})
+        message(FATAL_ERROR "skl_config_bake: \"${_BAKE_TARGET}\" is not a target!")
+    endif()
+
+    get_filename_component(_BAKE_JSON "${_BAKE_JSON}" ABSOLUTE)
+    get_filename_component(_BAKE_SCHEMA "${_BAKE_SCHEMA}" ABSOLUTE)
+
+    if(NOT _BAKE_NAME)
+        get_filename_component(_BAKE_NAME "${_BAKE_JSON}" NAME_WE)
+        string(MAKE_C_IDENTIFIER "${_BAKE_NAME}" _BAKE_NAME)
+    endif()
+
+    if(NOT _BAKE_OUTPUT_DIR)
+        set(_BAKE_OUTPUT_DIR "${CMAKE_CURRENT_BINARY_DIR}/skl_config_baked")
+    endif()
+
+    set(_TOOL_TARGET "skl-config-bake-${_BAKE_TARGET}-${_BAKE_NAME}")
+    set(_OUTPUT_FILE "${_BAKE_OUTPUT_DIR}/${_BAKE_NAME}.hpp")
+
+    # Host tool: the schema compiled with SKL_CONFIG_BAKE_TOOL defines main()
+    add_executable(${_TOOL_TARGET} "${_BAKE_SCHEMA}" ${_BAKE_SOURCES})
+    target_compile_definitions(${_TOOL_TARGET} PRIVATE SKL_CONFIG_BAKE_TOOL=1)
+    target_link_libraries(${_TOOL_TARGET} PRIVATE "libskl-config")
+    set_target_properties(${_TOOL_TARGET} PROPERTIES RUNTIME_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/bin/skl-config-bake")
+
+    add_custom_command(
+        OUTPUT "${_OUTPUT_FILE}"
+        COMMAND ${CMAKE_COMMAND} -E make_directory "${_BAKE_OUTPUT_DIR}"
+        COMMAND $<TARGET_FILE:${_TOOL_TARGET}> "${_BAKE_JSON}" "${_OUTPUT_FILE}" "${_BAKE_NAME}"
+        DEPENDS ${_TOOL_TARGET} "${_BAKE_JSON}"
+        COMMENT "Baking config ${_BAKE_JSON}"
+        VERBATIM
+    )
+
+    target_sources(${_BAKE_TARGET} PRIVATE "${_OUTPUT_FILE}")
+    target_include_directories(${_BAKE_TARGET} PRIVATE "${_BAKE_OUTPUT_DIR}")
+
+endfunction()
@@ -0,0 +1,61 @@
+#
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025 Balan Narcis (balannarcis96@gmail.com)
+#
+include_guard()
+
+#
+# Instantiate the config templates of a module's target types once, in a generated source
+#
+#   skl_config_instantiate(
+#       TARGET     <target>         # Target that compiles the instantiations
+#       HEADER     <schema.hpp>     # Header defining the target types, with SKL_CONFIG_EXTERN_TEMPLATES(T) for each
+#       TYPES      <T>...           # Fully qualified target types, eg. my::GameConfig
+#       [NAME       <name>]         # Generated source name, defaults to the header file name
+#       [OUTPUT_DIR <dir>])         # Defaults to ${CMAKE_CURRENT_BINARY_DIR}/skl_config_instantiated
+#
+# The generated source includes the header and expands SKL_CONFIG_INSTANTIATE_TEMPLATES(T) for each type,
+# every other TU of the target (and of its dependents) that includes the header skips these instantiations.
+# Headers that only name the configs should include <skl_config_fwd> instead of <skl_config>.
+#
+function( skl_config_instantiate )
+
+    cmake_parse_arguments(_INST "" "TARGET;HEADER;NAME;OUTPUT_DIR" "TYPES" ${ARGN})
+
+    if(NOT _INST_TARGET OR NOT _INST_HEADER OR NOT _INST_TYPES)
+        message(FATAL_ERROR "skl_config_instantiate requires TARGET, HEADER and TYPES!")
+    endif()
+
+    if(NOT TARGET ${_INST_TARGET})
+        message(FATAL_ERROR "skl_config_instantiate: \"${_INST_TARGET}\" is not a target!")
+    endif()
+
+    get_filename_component(_INST_HEADER "${_INST_HEADER}" ABSOLUTE)
+
+    if(NOT _INST_NAME)
+        get_filename_component(_INST_NAME "${_INST_HEADER}" NAME_WE)
+        string(MAKE_C_IDENTIFIER "${_INST_NAME}" _INST_NAME)
+    endif()
+
+    if(NOT _INST_OUTPUT_DIR)
+        set(_INST_OUTPUT_DIR "${CMAKE_CURRENT_BINARY_DIR}/skl_config_instantiated")
+    endif()
+
+    set(_OUTPUT_FILE "${_INST_OUTPUT_DIR}/${_INST_NAME}_instantiations.cpp")
+
+    set(_INSTANTIATIONS "")
+    foreach(_TYPE IN LISTS _INST_TYPES)
+        string(APPEND _INSTANTIATIONS "SKL_CONFIG_INSTANTIATE_TEMPLATES(${_TYPE})\n")
+    endforeach()
+
+    # Only rewritten when the content changes, no rebuild on every configure
+    file(CONFIGURE OUTPUT "${_OUTPUT_FILE}" CONTENT
+"// Generated by skl_config_instantiate(), do not edit
+#include \"@_INST_HEADER@\"
+
+@_INSTANTIATIONS@"
+        @ONLY)
+
+    target_sources(${_INST_TARGET} PRIVATE "${_OUTPUT_FILE}")
+
+endfunction()
@@ -41,4 +41,13 @@ function( skl_AddConfigTest
         COMMAND ${_TARGET_NAME}
     )
 
+    # Run again with each SIMD kernel variant forced (SKL_CONFIG_SIMD), variants the CPU lacks fall back to the best supported one
+    foreach(_SIMD_LEVEL IN ITEMS scalar sse42 avx2 avx512)
+        add_test(
+            NAME ${_TARGET_NAME}-simd-${_SIMD_LEVEL}
+            COMMAND ${_TARGET_NAME}
+        )
+        set_tests_properties(${_TARGET_NAME}-simd-${_SIMD_LEVEL} PROPERTIES ENVIRONMENT "SKL_CONFIG_SIMD=${_SIMD_LEVEL}")
+    endforeach()
+
 endfunction()
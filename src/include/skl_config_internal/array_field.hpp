@@ -67,6 +67,37 @@ public:
         return *this;
     }
 
+    //! Decode, validate and submit one element at a time into a staging container that is moved into the target on submit
+    //! \remark Bounds memory to the target container, an elements count above max_length is rejected before decoding
+    //! \remark The elements are validated and submitted (into the staging container) while loading, so an element
+    //!          schema with a post submit processor (nested ones included) is rejected: it would run before the rest
+    //!          of the config is validated, breaking the all or nothing submit
+    ArrayField& streaming(bool f_streaming) {
+        if (f_streaming && m_config.has_post_submit()) {
+            SERROR_LOCAL_T("Array field \"{}\" can not stream elements with a post submit processor!", this->path_name().c_str());
+            throw std::runtime_error("Streaming array elements with a post submit processor");
+        }
+
+        m_streaming = f_streaming;
+        return *this;
+    }
+
+    //! Locate the elements with a structural scan of the source and parse and load them in chunks on the executor
+    //! \remark Only for arrays of the root node loaded from a file without a preprocessor, otherwise the array is loaded as usual
+    //! \remark The executor is also used to validate the elements (and to stage them when streaming), nullptr disables
+    ArrayField& parallel_parse(Executor* f_executor = &default_executor()) noexcept {
+        m_parse_executor = f_executor;
+        return *this;
+    }
+
+    [[nodiscard]] Executor* executor() const noexcept override {
+        if (nullptr != m_parse_executor) {
+            return m_parse_executor;
+        }
+
+        return Field::executor();
+    }
+
     [[nodiscard]] std::string path_name() const noexcept override {
         if (nullptr == this->m_parent) {
             return std::string(this->name_cstr()) + "[]";
@@ -77,19 +108,30 @@ public:
 
 private:
     //! Load the object value from json
-    void load(json& f_json) override {
+    void load(const json& f_json) override {
         m_entries.clear();
+        m_staging.clear();
+        m_is_staged = false;
 
-        const auto exists = f_json.contains(this->name());
+        const auto it     = f_json.find(this->name());
+        const auto exists = f_json.end() != it;
         if (exists) {
-            if (f_json[this->name()].is_array()) {
-                for (auto& entry : f_json[this->name()]) {
-                    m_entries.push_back(m_config);
-                    m_entries.back().load(entry);
+            const auto& array = *it;
+            if (array.is_array()) {
+                auto* executor = this->executor();
+                if (m_streaming) {
+                    load_streaming(array);
+                } else if ((nullptr != executor) && (load_cost(f_json) >= CParallelMinCost)) {
+                    load_parallel(*executor, array);
+                } else {
+                    for (const auto& entry : array) {
+                        m_entries.push_back(m_config);
+                        m_entries.back().load(entry);
+                    }
                 }
                 m_is_default = false;
             } else {
-                SERROR_LOCAL_T("Field \"{}\" must be an array!\n\tjson: {}", this->path_name().c_str(), f_json[this->name()].dump().c_str());
+                SERROR_LOCAL_T("Field \"{}\" must be an array!\n\tjson: {}", this->path_name().c_str(), it->dump().c_str());
                 throw std::runtime_error("Wrong field type!");
             }
         } else {
@@ -111,6 +153,28 @@ private:
 
     //! Validate the field value
     void validate() override {
+        prepare_validate();
+        if (m_is_staged) {
+            // Elements were validated while streaming
+            return;
+        }
+
+        auto* executor = this->executor();
+        if ((nullptr != executor) && (validate_cost() >= CParallelMinCost)) {
+            parallel_for(*executor, m_entries.size(), element_grain(m_entries.front().validate_cost()), [this](u64 f_begin, u64 f_end) {
+                for (u64 i = f_begin; i < f_end; ++i) {
+                    m_entries[i].validate();
+                }
+            });
+        } else {
+            for (auto& entry : m_entries) {
+                entry.validate();
+            }
+        }
+    }
+
+    //! Materialize the default entries (if any) and check the elements count
+    void prepare_validate() {
         if (m_is_default) {
             SKL_ASSERT(m_default.has_value());
 
@@ -122,20 +186,247 @@ private:
             }
         }
 
-        if ((m_entries.size() < m_min_length) || (m_entries.size() > m_max_length)) {
+        const auto count = m_is_staged ? m_staging.size() : m_entries.size();
+        if ((count < m_min_length) || (count > m_max_length)) {
             SERROR_LOCAL_T("Array field \"{}\" elements count must be in [min={}, max={}]!", this->path_name().c_str(), m_min_length, m_max_length);
             throw std::runtime_error("Array field has invalid length!");
         }
+    }
 
-        for (auto& entry : m_entries) {
-            entry.validate();
+    //! Decode, validate and stage the elements one by one, reusing a single node
+    void load_streaming(const json& f_array) {
+        if (f_array.size() > m_max_length) {
+            SERROR_LOCAL_T("Array field \"{}\" elements count({}) exceeds max={}!", this->path_name().c_str(), f_array.size(), m_max_length);
+            throw std::runtime_error("Array field has invalid length!");
+        }
+
+        m_staging.reserve(f_array.size());
+
+        ConfigNode<_Object> node = m_config;
+        for (const auto& entry : f_array) {
+            node.reset();
+            node.load(entry);
+            node.validate();
+            node.submit(m_staging.emplace_back());
         }
+
+        m_is_staged = true;
+    }
+
+    //! Move the staged elements into the target container
+    void submit_staged(_Container& f_field) {
+        if constexpr (__is_same(_Container, std::vector<_Object>)) {
+            f_field = std::move(m_staging);
+            m_staging.clear();
+        } else {
+            if constexpr (CIsATRPContainer) {
+                f_field.upgrade().clear();
+            } else {
+                f_field.clear();
+            }
+
+            if constexpr (CIsResizableContainer) {
+                if constexpr (CIsATRPContainer) {
+                    f_field.upgrade().resize(m_staging.size());
+                } else {
+                    f_field.resize(m_staging.size());
+                }
+
+                for (u64 i = 0ULL; i < f_field.size(); ++i) {
+                    f_field[i] = std::move(m_staging[i]);
+                }
+            } else {
+                if (m_staging.size() > f_field.capacity()) {
+                    if (false == m_truncate_on_overflow) {
+                        SERROR_LOCAL_T("Array field \"{}\" elements count({}) does not fit in the target fixed capacity({}) container!", this->path_name().c_str(), m_staging.size(), f_field.capacity());
+                        throw std::runtime_error("Array elements overflow the target container!");
+                    }
+                }
+
+                for (u64 i = 0ULL; i < std::min(f_field.capacity(), m_staging.size()); ++i) {
+                    if constexpr (CIsATRPContainer) {
+                        (void)f_field.upgrade().emplace_back(std::move(m_staging[i]));
+                    } else {
+                        f_field.emplace_back(std::move(m_staging[i]));
+                    }
+                }
+            }
+
+            m_staging.clear();
+        }
+    }
+
+    [[nodiscard]] bool loads_source() const noexcept override {
+        return nullptr != m_parse_executor;
+    }
+
+    void load_source(std::string_view f_source, json_span_t f_value) override {
+        JsonScanner scanner{f_source};
+        const auto  elements = scanner.array_elements(f_value, m_streaming ? static_cast<u64>(m_max_length) : ~0ULL);
+        if (false == elements.has_value()) {
+            // Not an array or malformed, load it as usual to report it
+            json holder          = json::object();
+            holder[this->name()] = parse_json_slice(f_source, f_value);
+            load(holder);
+            return;
+        }
+
+        load_elements(f_source, elements.value());
+    }
+
+    //! Parse and load (stage when streaming) the elements from their source slices in chunks on the executor
+    void load_elements(std::string_view f_source, std::span<const json_span_t> f_elements) {
+        SKL_ASSERT(nullptr != m_parse_executor);
+
+        m_entries.clear();
+        m_staging.clear();
+        m_is_staged          = false;
+        m_is_default         = false;
+        m_is_validation_only = false;
+
+        if (f_elements.empty()) {
+            return;
+        }
+
+        if (m_streaming && (f_elements.size() > m_max_length)) {
+            SERROR_LOCAL_T("Array field \"{}\" elements count({}) exceeds max={}!", this->path_name().c_str(), f_elements.size(), m_max_length);
+            throw std::runtime_error("Array field has invalid length!");
+        }
+
+        // ~ one json value per CScanBytesPerValue bytes of source
+        constexpr u64 CScanBytesPerValue = 16ULL;
+        const auto    average_bytes      = (f_elements.back().m_end - f_elements.front().m_begin) / f_elements.size();
+        const auto    grain              = element_grain(average_bytes / CScanBytesPerValue);
+
+        if (m_streaming) {
+            m_staging.resize(f_elements.size());
+        } else {
+            m_entries.resize(f_elements.size());
+        }
+
+        parallel_for(*m_parse_executor, f_elements.size(), grain, [this, f_source, f_elements](u64 f_begin, u64 f_end) {
+            ConfigNode<_Object> node = m_config;
+            for (u64 i = f_begin; i < f_end; ++i) {
+                auto element = parse_element(f_source, f_elements[i], i);
+                if (m_streaming) {
+                    node.reset();
+                    node.load(element);
+                    node.validate();
+                    node.submit(m_staging[i]);
+                } else {
+                    m_entries[i] = m_config;
+                    m_entries[i].set_parent(m_config.name(), *this);
+                    m_entries[i].load(element);
+                }
+            }
+        });
+
+        m_is_staged = m_streaming;
+    }
+
+    [[nodiscard]] json parse_element(std::string_view f_source, json_span_t f_element, u64 f_index) const {
+        try {
+            return parse_json_slice(f_source, f_element);
+        } catch (const json::exception& f_ex) {
+            SERROR_LOCAL_T("Array field \"{}\" element [{}] is not valid json! {}", this->path_name().c_str(), f_index, f_ex.what());
+            throw std::runtime_error("Invalid array element json!");
+        }
+    }
+
+    bool load_step(const json& f_json, u64 f_step) override {
+        if (0ULL == f_step) {
+            const auto it = f_json.find(this->name());
+            if (m_streaming || (f_json.end() == it) || (false == it->is_array())) {
+                // Missing, defaulted or invalid, nothing to split
+                load(f_json);
+                return true;
+            }
+
+            m_entries.clear();
+            m_entries.reserve(it->size());
+            m_is_default         = false;
+            m_is_validation_only = false;
+            return it->empty();
+        }
+
+        const auto& array = f_json.at(this->name());
+        m_entries.push_back(m_config);
+        m_entries.back().load(array[f_step - 1ULL]);
+        return f_step == array.size();
+    }
+
+    bool validate_step(u64 f_step) override {
+        if (0ULL == f_step) {
+            prepare_validate();
+            return m_is_staged || m_entries.empty();
+        }
+
+        m_entries[f_step - 1ULL].validate();
+        return f_step == m_entries.size();
+    }
+
+    //! Load the elements in chunks on the executor, the first failing element (in order) is reported
+    void load_parallel(Executor& f_executor, const json& f_array) {
+        m_entries.resize(f_array.size());
+
+        parallel_for(f_executor, m_entries.size(), element_grain(m_config.load_cost(f_array.front())), [this, &f_array](u64 f_begin, u64 f_end) {
+            for (u64 i = f_begin; i < f_end; ++i) {
+                m_entries[i] = m_config;
+                m_entries[i].set_parent(m_config.name(), *this);
+                m_entries[i].load(f_array[i]);
+            }
+        });
+    }
+
+    //! Elements per chunk so that a chunk is worth a task
+    [[nodiscard]] static u64 element_grain(u64 f_element_cost) noexcept {
+        return std::max<u64>(1ULL, (CParallelMinCost / 4ULL) / std::max<u64>(1ULL, f_element_cost));
+    }
+
+    [[nodiscard]] u64 load_cost(const json& f_json) const noexcept override {
+        const auto it = f_json.find(this->name());
+        if ((f_json.end() == it) || (false == it->is_array()) || it->empty()) {
+            return 1ULL;
+        }
+
+        return it->size() * std::max<u64>(1ULL, m_config.load_cost(it->front()));
+    }
+
+    //! Streaming arrays are rejected while parsed, before a longer than max_length array is built
+    void collect_length_limits(length_limit_node_t& f_parent) const override {
+        length_limit_node_t node{.m_name = std::string{this->name()}};
+        if (m_streaming && (std::numeric_limits<u32>::max() != m_max_length)) {
+            node.m_path       = path_name();
+            node.m_max_length = m_max_length;
+        }
+
+        m_config.collect_length_limits(node);
+        if (false == node.empty()) {
+            f_parent.m_children.push_back(std::move(node));
+        }
+    }
+
+    [[nodiscard]] bool has_post_submit() const noexcept override {
+        return m_config.has_post_submit();
+    }
+
+    [[nodiscard]] u64 validate_cost() const noexcept override {
+        if (m_entries.empty()) {
+            return 1ULL;
+        }
+
+        return m_entries.size() * std::max<u64>(1ULL, m_entries.front().validate_cost());
     }
 
     //! Submit valid value into given config object
     void submit(_TargetConfig& f_config) override {
         auto& field = f_config.*m_member_ptr;
 
+        if (m_is_staged) {
+            submit_staged(field);
+            return;
+        }
+
         if constexpr (CIsATRPContainer) {
             field.upgrade().clear();
         } else {
@@ -177,6 +468,8 @@ private:
 
         m_entries.clear();
         m_entries.reserve(field.size());
+        m_staging.clear();
+        m_is_staged = false;
 
         for (const auto& entry : field) {
             m_entries.push_back(m_config);
@@ -192,6 +485,8 @@ private:
 
         m_entries.clear();
         m_entries.reserve(field.size());
+        m_staging.clear();
+        m_is_staged = false;
 
         for (const auto& entry : field) {
             m_entries.push_back(m_config);
@@ -206,17 +501,96 @@ private:
         return std::make_unique<ArrayField<_Object, _TargetConfig, _Container>>(*this);
     }
 
+    void apply_filter(const path_filter_node_t* f_filter) override {
+        m_config.apply_filter(f_filter);
+    }
+
     void update_parent(Field& f_new_parent) noexcept override {
         Field::update_parent(f_new_parent);
-        m_config.update_parent(f_new_parent);
+        m_config.update_parent(*this);
 
         for (auto& entry : m_entries) {
-            entry.update_parent(f_new_parent);
+            entry.update_parent(*this);
+        }
+    }
+
+    void serialize(const _TargetConfig& f_config, JsonWriter& f_writer) const override {
+        f_writer.key(this->name());
+        serialize_value(f_config.*m_member_ptr, f_writer);
+    }
+
+    //! Write a value of this field as json
+    void serialize_value(const _Container& f_value, JsonWriter& f_writer) const {
+        f_writer.begin_array();
+        for (const auto& entry : f_value) {
+            m_config.serialize(entry, f_writer);
         }
+        f_writer.end_array();
+    }
+
+    void hash_schema(SchemaHasher& f_hasher) const override {
+        f_hasher.add_type<ArrayField<_Object, _TargetConfig, _Container>>();
+        f_hasher.add_string(this->name());
+        f_hasher.add(m_default.has_value());
+        if (m_default.has_value()) {
+            f_hasher.add(m_default->size());
+        }
+        f_hasher.add(m_min_length);
+        f_hasher.add(m_max_length);
+        f_hasher.add(m_required);
+        f_hasher.add(m_truncate_on_overflow);
+        f_hasher.add(m_streaming);
+        m_config.hash_schema(f_hasher);
+    }
+
+    void save_state(SnapshotWriter& f_writer) const override {
+        if (m_is_staged) {
+            // Same layout as the entries, the staged objects are re-read through a node
+            f_writer.write_size(m_staging.size());
+
+            ConfigNode<_Object> node = m_config;
+            for (const auto& object : m_staging) {
+                node.load_fields_from_default_object(object);
+                node.save_state(f_writer);
+            }
+            return;
+        }
+
+        f_writer.write_size(m_entries.size());
+        for (const auto& entry : m_entries) {
+            entry.save_state(f_writer);
+        }
+    }
+
+    void load_state(SnapshotReader& f_reader) override {
+        const auto count = f_reader.read_size();
+
+        m_entries.clear();
+        m_staging.clear();
+        m_is_staged = m_streaming;
+
+        if (m_streaming) {
+            ConfigNode<_Object> node = m_config;
+            m_staging.reserve(count);
+            for (u64 i = 0ULL; i < count; ++i) {
+                node.load_state(f_reader);
+                node.submit(m_staging.emplace_back());
+            }
+        } else {
+            for (u64 i = 0ULL; i < count; ++i) {
+                m_entries.push_back(m_config);
+                m_entries.back().load_state(f_reader);
+            }
+        }
+
+        m_is_default         = false;
+        m_is_validation_only = false;
     }
 
     void reset() override {
         m_entries.clear();
+        m_staging.clear();
+        m_is_staged          = false;
         m_is_default         = false;
         m_is_validation_only = false;
     }
@@ -225,13 +599,20 @@ private:
     member_ptr_t                        m_member_ptr;
     ConfigNode<_Object>                 m_config;
     std::vector<ConfigNode<_Object>>    m_entries;
+    std::vector<_Object>                m_staging;
     std::optional<std::vector<_Object>> m_default;
+    Executor*                           m_parse_executor{nullptr};
     u32                                 m_min_length = 0U;
     u32                                 m_max_length = std::numeric_limits<u32>::max();
     bool                                m_required{false};
     bool                                m_is_default{false};
     bool                                m_is_validation_only{false};
     bool                                m_truncate_on_overflow{false};
+    bool                                m_streaming{false};
+    bool                                m_is_staged{false};
+
+    template <CConfigTargetType, CConfigTargetType, CContainerType>
+    friend class LazyArrayField;
 };
 } // namespace skl::config
 
@@ -78,19 +78,26 @@ public:
 
 private:
     //! Load the object value from json
-    void load(json& f_json) override {
+    void load(const json& f_json) override {
         m_entries.clear();
 
-        const auto exists = f_json.contains(this->name());
+        const auto it     = f_json.find(this->name());
+        const auto exists = f_json.end() != it;
         if (exists) {
-            if (f_json[this->name()].is_array()) {
-                for (auto& entry : f_json[this->name()]) {
-                    m_entries.push_back(m_config);
-                    m_entries.back().load(entry);
+            const auto& array = *it;
+            if (array.is_array()) {
+                auto* executor = this->executor();
+                if ((nullptr != executor) && (load_cost(f_json) >= CParallelMinCost)) {
+                    load_parallel(*executor, array);
+                } else {
+                    for (const auto& entry : array) {
+                        m_entries.push_back(m_config);
+                        m_entries.back().load(entry);
+                    }
                 }
                 m_is_default = false;
             } else {
-                SERROR_LOCAL_T("Field \"{}\" must be an array!\n\tjson: {}", this->path_name().c_str(), f_json[this->name()].dump().c_str());
+                SERROR_LOCAL_T("Field \"{}\" must be an array!\n\tjson: {}", this->path_name().c_str(), it->dump().c_str());
                 throw std::runtime_error("Wrong field type!");
             }
         } else {
@@ -112,6 +119,24 @@ private:
 
     //! Validate the field value
     void validate() override {
+        prepare_validate();
+
+        auto* executor = this->executor();
+        if ((nullptr != executor) && (validate_cost() >= CParallelMinCost)) {
+            parallel_for(*executor, m_entries.size(), element_grain(m_entries.front().validate_cost()), [this](u64 f_begin, u64 f_end) {
+                for (u64 i = f_begin; i < f_end; ++i) {
+                    m_entries[i].validate();
+                }
+            });
+        } else {
+            for (auto& entry : m_entries) {
+                entry.validate();
+            }
+        }
+    }
+
+    //! Materialize the default entries (if any) and check the elements count
+    void prepare_validate() {
         if (m_is_default) {
             SKL_ASSERT(m_default.has_value());
 
@@ -131,10 +156,77 @@ private:
             SERROR_LOCAL_T("Array field \"{}\" elements count must be in [min={}, max={}]!", this->path_name().c_str(), m_min_length, m_max_length);
             throw std::runtime_error("Array field has invalid length!");
         }
+    }
 
-        for (auto& entry : m_entries) {
-            entry.validate();
+    bool load_step(const json& f_json, u64 f_step) override {
+        if (0ULL == f_step) {
+            const auto it = f_json.find(this->name());
+            if ((f_json.end() == it) || (false == it->is_array())) {
+                // Missing, defaulted or invalid, nothing to split
+                load(f_json);
+                return true;
+            }
+
+            m_entries.clear();
+            m_entries.reserve(it->size());
+            m_is_default         = false;
+            m_is_validation_only = false;
+            return it->empty();
+        }
+
+        const auto& array = f_json.at(this->name());
+        m_entries.push_back(m_config);
+        m_entries.back().load(array[f_step - 1ULL]);
+        return f_step == array.size();
+    }
+
+    bool validate_step(u64 f_step) override {
+        if (0ULL == f_step) {
+            prepare_validate();
+            return m_entries.empty();
+        }
+
+        m_entries[f_step - 1ULL].validate();
+        return f_step == m_entries.size();
+    }
+
+    //! Load the elements in chunks on the executor, the first failing element (in order) is reported
+    void load_parallel(Executor& f_executor, const json& f_array) {
+        m_entries.resize(f_array.size());
+
+        parallel_for(f_executor, m_entries.size(), element_grain(m_config.load_cost(f_array.front())), [this, &f_array](u64 f_begin, u64 f_end) {
+            for (u64 i = f_begin; i < f_end; ++i) {
+                m_entries[i] = m_config;
+                m_entries[i].set_parent(m_config.name(), *this);
+                m_entries[i].load(f_array[i]);
+            }
+        });
+    }
+
+    //! Elements per chunk so that a chunk is worth a task
+    [[nodiscard]] static u64 element_grain(u64 f_element_cost) noexcept {
+        return std::max<u64>(1ULL, (CParallelMinCost / 4ULL) / std::max<u64>(1ULL, f_element_cost));
+    }
+
+    [[nodiscard]] u64 load_cost(const json& f_json) const noexcept override {
+        const auto it = f_json.find(this->name());
+        if ((f_json.end() == it) || (false == it->is_array()) || it->empty()) {
+            return 1ULL;
+        }
+
+        return it->size() * std::max<u64>(1ULL, m_config.load_cost(it->front()));
+    }
+
+    [[nodiscard]] bool has_post_submit() const noexcept override {
+        return m_config.has_post_submit();
+    }
+
+    [[nodiscard]] u64 validate_cost() const noexcept override {
+        if (m_entries.empty()) {
+            return 1ULL;
         }
+
+        return m_entries.size() * std::max<u64>(1ULL, m_entries.front().validate_cost());
     }
 
     //! Submit valid value into given config object
@@ -224,6 +316,10 @@ private:
         return std::make_unique<ArrayViaProxyField<_Object, _ProxyType, _TargetConfig, _Container>>(*this);
     }
 
+    void apply_filter(const path_filter_node_t* f_filter) override {
+        m_config.apply_filter(f_filter);
+    }
+
     void update_parent(Field& f_new_parent) noexcept override {
         Field::update_parent(f_new_parent);
         m_config.update_parent(*this);
@@ -233,6 +329,56 @@ private:
         }
     }
 
+    void serialize(const _TargetConfig& f_config, JsonWriter& f_writer) const override {
+        // The proxy needs a (non const) field to report to, a copy of the node provides one
+        ConfigNode<_ProxyType> node = m_config;
+
+        f_writer.key(this->name());
+        f_writer.begin_array();
+        for (const auto& entry : f_config.*m_member_ptr) {
+            _ProxyType temp{};
+            if (false == temp.load(node, entry)) {
+                throw std::runtime_error("Proxy array -> proxy failed to load from object!");
+            }
+            node.serialize(temp, f_writer);
+        }
+        f_writer.end_array();
+    }
+
+    void hash_schema(SchemaHasher& f_hasher) const override {
+        f_hasher.add_type<ArrayViaProxyField<_Object, _ProxyType, _TargetConfig, _Container>>();
+        f_hasher.add_string(this->name());
+        f_hasher.add(m_default.has_value());
+        if (m_default.has_value()) {
+            f_hasher.add(m_default->size());
+        }
+        f_hasher.add(m_min_length);
+        f_hasher.add(m_max_length);
+        f_hasher.add(m_required);
+        f_hasher.add(m_truncate_on_overflow);
+        m_config.hash_schema(f_hasher);
+    }
+
+    void save_state(SnapshotWriter& f_writer) const override {
+        f_writer.write_size(m_entries.size());
+        for (const auto& entry : m_entries) {
+            entry.save_state(f_writer);
+        }
+    }
+
+    void load_state(SnapshotReader& f_reader) override {
+        const auto count = f_reader.read_size();
+
+        m_entries.clear();
+        for (u64 i = 0ULL; i < count; ++i) {
+            m_entries.push_back(m_config);
+            m_entries.back().load_state(f_reader);
+        }
+
+        m_is_default         = false;
+        m_is_validation_only = false;
+    }
+
     void reset() override {
         m_entries.clear();
         m_is_default         = false;
@@ -0,0 +1,86 @@
+//!
+//! \file bake
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <cstdio>
+#include <span>
+#include <string>
+#include <string_view>
+
+//! Entry point of a config bake tool (see cmake/modules/SkylakeConfigBake.cmake)
+//! \remark Expands to main() only when building the bake tool, so the schema source can be shared with the application
+//! \remark (_Loader) -> ConfigNode<_Type>&
+#if defined(SKL_CONFIG_BAKE_TOOL)
+#    define SKL_CONFIG_BAKE(_Type, _Loader)                                  \
+        int main(int f_argc, const char** f_argv) {                          \
+            return ::skl::config::bake_main<_Type>(f_argc, f_argv, _Loader); \
+        }
+#else
+#    define SKL_CONFIG_BAKE(_Type, _Loader)
+#endif
+
+//! \remark Included at the end of skl_config, after ConfigNode is complete
+namespace skl::config {
+//! Write the snapshot image as a C++ header with a constexpr byte array named \p f_symbol
+[[nodiscard]] inline bool write_baked_header(const char* f_output_file, std::string_view f_symbol, std::string_view f_source_file, std::span<const u8> f_image) noexcept {
+    std::string text{};
+    text.reserve(512U + (f_image.size() * 6U));
+
+    text += "//!\n//! \\file ";
+    text += f_symbol;
+    text += "\n//!\n//! Generated by skl_config_bake from ";
+    text += f_source_file;
+    text += ", do not edit.\n//!\n#pragma once\n\n#include <cstdint>\n#include <span>\n\nnamespace skl_config_baked {\nalignas(16) inline constexpr std::uint8_t ";
+    text += f_symbol;
+    text += "_image[] = {";
+
+    char hex[8U];
+    for (u64 i = 0ULL; i < f_image.size(); ++i) {
+        text += (0ULL == (i % 16ULL)) ? "\n    " : " ";
+        (void)std::snprintf(hex, sizeof(hex), "0x%02x,", f_image[i]);
+        text += hex;
+    }
+
+    text += "\n};\n\n//! Load with ConfigNode<T>::load_snapshot(skl_config_baked::";
+    text += f_symbol;
+    text += ", out_config)\ninline constexpr std::span<const std::uint8_t> ";
+    text += f_symbol;
+    text += "{";
+    text += f_symbol;
+    text += "_image};\n} // namespace skl_config_baked\n";
+
+    std::FILE* file = std::fopen(f_output_file, "wb");
+    if (nullptr == file) {
+        return false;
+    }
+
+    const bool written = (text.size() == std::fwrite(text.data(), 1U, text.size(), file));
+    return (0 == std::fclose(file)) && written;
+}
+
+//! Load and validate the json file with \p f_loader and write the baked header
+//! \remark Usage: <tool> <json file> <output header> <symbol>, returns non-zero on any failure (fails the build)
+template <typename _Type>
+[[nodiscard]] int bake_main(int f_argc, const char** f_argv, ConfigNode<_Type>& f_loader) noexcept {
+    if (4 != f_argc) {
+        (void)std::fprintf(stderr, "usage: %s <json file> <output header> <symbol>\n", (0 < f_argc) ? f_argv[0] : "skl-config-bake");
+        return 1;
+    }
+
+    try {
+        const auto image = f_loader.load_validate_and_snapshot(skl_string_view::from_cstr(f_argv[1]));
+        if (false == write_baked_header(f_argv[2], f_argv[3], f_argv[1], image)) {
+            (void)std::fprintf(stderr, "skl_config_bake: failed to write \"%s\"!\n", f_argv[2]);
+            return 1;
+        }
+    } catch (const std::exception& f_error) {
+        (void)std::fprintf(stderr, "skl_config_bake: config \"%s\" is invalid! %s\n", f_argv[1], f_error.what());
+        return 1;
+    }
+
+    return 0;
+}
+} // namespace skl::config
@@ -0,0 +1,24 @@
+//!
+//! \file batch
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "skl_config_internal/common.hpp"
+
+namespace skl::config {
+//! Number of files prefetched ahead of the ones being parsed by ConfigNode::load_batch()
+constexpr u64 CBatchPrefetchWindow = 64ULL;
+
+//! Result of loading one file of a batch
+template <CConfigTargetType _TargetConfig>
+struct batch_result_t {
+    _TargetConfig            m_config{};
+    std::vector<std::string> m_errors{}; //!< Field errors followed by the load error, empty on success
+    bool                     m_loaded{false};
+};
+} // namespace skl::config
@@ -98,10 +98,11 @@ public:
     }
 
 protected:
-    void load(json& f_json) override {
-        const auto exists = f_json.contains(this->name());
+    void load(const json& f_json) override {
+        const auto it     = f_json.find(this->name());
+        const auto exists = f_json.end() != it;
         if (exists) {
-            auto& json = f_json[this->name()];
+            const auto& json = *it;
 
             if (json.is_string()) {
                 if (false == m_interpret_str) {
@@ -109,13 +110,13 @@ protected:
                     throw std::runtime_error("Boolean field cannot be interpreted from string value!");
                 }
 
-                const auto temp = json.template get<std::string>();
+                const auto temp = json_string_view(json);
                 if (m_true_string == temp) {
                     m_value = true;
                 } else if (m_false_string == temp) {
                     m_value = false;
                 } else {
-                    SERROR_LOCAL_T("Boolean field \"{}\" cannot be interpreted from the given string value(\"{}\")!", this->path_name().c_str(), skl_string_view::from_std(std::string_view{temp}));
+                    SERROR_LOCAL_T("Boolean field \"{}\" cannot be interpreted from the given string value(\"{}\")!", this->path_name().c_str(), skl_string_view::from_std(temp));
                     throw std::runtime_error("Boolean field cannot be interpreted from the given string value!");
                 }
             } else if (json.is_number()) {
@@ -209,6 +210,39 @@ protected:
         return std::make_unique<BooleanField<_Type, _TargetConfig>>(*this);
     }
 
+    void serialize(const _TargetConfig& f_config, JsonWriter& f_writer) const override {
+        f_writer.key(this->name());
+        if constexpr (__is_same(_Type, bool)) {
+            (void)f_writer.value(f_config.*m_member_ptr);
+        } else {
+            (void)f_writer.value(_Type(0) != f_config.*m_member_ptr);
+        }
+    }
+
+    void hash_schema(SchemaHasher& f_hasher) const override {
+        f_hasher.add_type<BooleanField<_Type, _TargetConfig>>();
+        f_hasher.add_string(this->name());
+        f_hasher.add_optional(m_default);
+        f_hasher.add_string(m_true_string);
+        f_hasher.add_string(m_false_string);
+        f_hasher.add(m_required);
+        f_hasher.add(m_validate_if_default);
+        f_hasher.add(m_interpret_str);
+        f_hasher.add(m_interpret_numeric);
+        f_hasher.add(m_constraints.size());
+    }
+
+    void save_state(SnapshotWriter& f_writer) const override {
+        f_writer.write_optional(m_value);
+        f_writer.write(m_is_default);
+    }
+
+    void load_state(SnapshotReader& f_reader) override {
+        m_value              = f_reader.read_optional<bool>();
+        m_is_default         = f_reader.read<bool>();
+        m_is_validation_only = false;
+    }
+
 private:
     std::optional<bool> m_value;
     std::optional<bool> m_default;
@@ -5,6 +5,10 @@
 //!
 #pragma once
 
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 #include <skl_log>
 
 #include "skl_config_internal/numeric_field.hpp"
@@ -34,6 +38,9 @@ public:
     using member_ptr_t = _Object (_TargetConfig::*)[_N];
     using field_t      = field_selector_t<_Object>::type;
 
+    //! Values decoded in bulk (numeric elements only), sized on load so unloaded fields and their clones stay small
+    using bulk_values_t = std::conditional_t<CNumericValueFieldType<_Object>, std::vector<_Object>, std::vector<u8>>;
+
     CArrayField(Field* f_parent, std::string_view f_field_name, member_ptr_t f_member_ptr) noexcept
         : ConfigField<_TargetConfig>(f_parent, f_field_name)
         , m_member_ptr(f_member_ptr)
@@ -71,19 +78,25 @@ public:
 
 private:
     //! Load the field values from json
-    void load(json& f_json) override {
+    void load(const json& f_json) override {
         m_entries.clear();
+        m_is_bulk = false;
 
-        const auto exists = f_json.contains(this->name());
+        const auto it     = f_json.find(this->name());
+        const auto exists = f_json.end() != it;
         if (exists) {
-            if (f_json[this->name()].is_array()) {
-                for (auto& entry : f_json[this->name()]) {
-                    m_entries.push_back(m_field_proto);
-                    m_entries.back().load(entry);
+            if (it->is_array()) {
+                if (is_bulk_decodable()) {
+                    load_bulk(*it);
+                } else {
+                    for (const auto& entry : *it) {
+                        m_entries.push_back(m_field_proto);
+                        m_entries.back().load(entry);
+                    }
                 }
                 m_is_default = false;
             } else {
-                SERROR_LOCAL_T("Field \"{}\" must be an array!\n\tjson: {}", this->path_name().c_str(), f_json[this->name()].dump().c_str());
+                SERROR_LOCAL_T("Field \"{}\" must be an array!\n\tjson: {}", this->path_name().c_str(), it->dump().c_str());
                 throw std::runtime_error("Wrong field type!");
             }
         } else {
@@ -105,20 +118,59 @@ private:
             return;
         }
 
-        if (m_entries.size() > _N) {
+        if (entries_count() > _N) {
             if (false == m_truncate_on_overflow) {
-                SERROR_LOCAL_T("C-array field \"{}\" elements count({}) exceeds capacity({})!", this->path_name().c_str(), m_entries.size(), _N);
+                SERROR_LOCAL_T("C-array field \"{}\" elements count({}) exceeds capacity({})!", this->path_name().c_str(), entries_count(), _N);
                 throw std::runtime_error("C-array elements overflow!");
             }
         }
 
-        const auto count = std::min(static_cast<u64>(_N), static_cast<u64>(m_entries.size()));
+        const auto count = std::min(static_cast<u64>(_N), entries_count());
+        if (m_is_bulk) {
+            if constexpr (CNumericValueFieldType<_Object>) {
+                m_field_proto.bulk_check(m_bulk_values.data(), count);
+            }
+            return;
+        }
+
         for (u64 i = 0ULL; i < count; ++i) {
             m_entries[i].validate();
         }
     }
 
+    //! Are the elements plain numbers, decoded straight into the values buffer by load_bulk()
+    [[nodiscard]] bool is_bulk_decodable() const noexcept {
+        if constexpr (CNumericValueFieldType<_Object>) {
+            return m_field_proto.is_bulk_decodable();
+        } else {
+            return false;
+        }
+    }
+
+    //! Decode the elements into the values buffer, no per element field
+    void load_bulk(const json& f_array) {
+        if constexpr (CNumericValueFieldType<_Object>) {
+            const auto count = std::min(static_cast<u64>(_N), static_cast<u64>(f_array.size()));
+            m_bulk_values.resize(count);
+            m_field_proto.bulk_decode(f_array, 0ULL, count, m_bulk_values.data());
+
+            // Past the capacity, decoded only to report invalid values
+            for (u64 i = count; i < f_array.size(); ++i) {
+                _Object discarded;
+                m_field_proto.bulk_decode(f_array, i, i + 1ULL, &discarded);
+            }
+
+            m_bulk_count = f_array.size();
+            m_is_bulk    = true;
+        }
+    }
+
 protected:
+    //! Number of loaded elements (may exceed _N)
+    [[nodiscard]] u64 entries_count() const noexcept {
+        return m_is_bulk ? m_bulk_count : static_cast<u64>(m_entries.size());
+    }
+
     //! Submit valid values into given config object
     void submit(_TargetConfig& f_config) override {
         auto& field = f_config.*m_member_ptr;
@@ -132,7 +184,14 @@ protected:
             return;
         }
 
-        const auto count = std::min(static_cast<u64>(_N), static_cast<u64>(m_entries.size()));
+        const auto count = std::min(static_cast<u64>(_N), entries_count());
+        if (m_is_bulk) {
+            if constexpr (CNumericValueFieldType<_Object>) {
+                std::copy_n(m_bulk_values.data(), count, field);
+            }
+            return;
+        }
+
         for (u64 i = 0ULL; i < count; ++i) {
             field_value_proxy_t proxy{};
             m_entries[i].submit(proxy);
@@ -146,6 +205,7 @@ private:
 
         m_entries.clear();
         m_entries.reserve(_N);
+        m_is_bulk = false;
 
         for (u32 i = 0; i < _N; ++i) {
             m_entries.emplace_back(m_field_proto);
@@ -162,6 +222,7 @@ private:
 
         m_entries.clear();
         m_entries.reserve(_N);
+        m_is_bulk = false;
 
         for (u32 i = 0; i < _N; ++i) {
             m_entries.emplace_back(m_field_proto);
@@ -186,8 +247,74 @@ private:
         }
     }
 
+protected:
+    void serialize(const _TargetConfig& f_config, JsonWriter& f_writer) const override {
+        serialize_entries(f_config, _N, f_writer);
+    }
+
+    void serialize_entries(const _TargetConfig& f_config, u64 f_count, JsonWriter& f_writer) const {
+        const auto& field = f_config.*m_member_ptr;
+
+        f_writer.key(this->name());
+        f_writer.begin_array();
+        for (u64 i = 0ULL; i < f_count; ++i) {
+            field_t::serialize_value(field[i], f_writer);
+        }
+        f_writer.end_array();
+    }
+
+    void hash_schema(SchemaHasher& f_hasher) const override {
+        f_hasher.add_type<CArrayField<_Object, _N, _TargetConfig>>();
+        f_hasher.add_string(this->name());
+        f_hasher.add(m_required);
+        f_hasher.add(m_truncate_on_overflow);
+        m_field_proto.hash_schema(f_hasher);
+    }
+
+    void save_state(SnapshotWriter& f_writer) const override {
+        f_writer.write(m_is_default);
+        if (m_is_bulk) {
+            // Same layout as the entries, the values are re-read through a field
+            if constexpr (CNumericValueFieldType<_Object>) {
+                const auto count = std::min(static_cast<u64>(_N), m_bulk_count);
+                f_writer.write_size(count);
+
+                field_t field{m_field_proto};
+                for (u64 i = 0ULL; i < count; ++i) {
+                    field_value_proxy_t temp{.value = m_bulk_values[i]};
+                    field.load_value_from_default_object(temp);
+                    field.save_state(f_writer);
+                }
+            }
+            return;
+        }
+
+        f_writer.write_size(m_entries.size());
+        for (const auto& entry : m_entries) {
+            entry.save_state(f_writer);
+        }
+    }
+
+    void load_state(SnapshotReader& f_reader) override {
+        m_is_default     = f_reader.read<bool>();
+        const auto count = f_reader.read_size();
+
+        m_entries.clear();
+        m_entries.reserve(count);
+        m_is_bulk = false;
+        for (u64 i = 0ULL; i < count; ++i) {
+            m_entries.push_back(m_field_proto);
+            m_entries.back().load_state(f_reader);
+        }
+
+        m_is_validation_only = false;
+    }
+
+private:
     void reset() override {
         m_entries.clear();
+        m_bulk_values.clear();
+        m_is_bulk            = false;
         m_is_default         = false;
         m_is_validation_only = false;
     }
@@ -196,10 +323,13 @@ protected:
     member_ptr_t         m_member_ptr;
     field_t              m_field_proto;
     std::vector<field_t> m_entries;
+    bulk_values_t        m_bulk_values{};
+    u64                  m_bulk_count{0ULL}; //!< Elements count of the json array, values past _N are not kept
     bool                 m_required{false};
     bool                 m_is_default{false};
     bool                 m_is_validation_only{false};
     bool                 m_truncate_on_overflow{false};
+    bool                 m_is_bulk{false}; //!< Loaded into m_bulk_values instead of m_entries
 };
 template <CPrimitiveValueFieldType _Object, u32 _N, CConfigTargetType _TargetConfig, CIntegerValueFieldType _CountType>
 class CArrayCountField : public CArrayField<_Object, _N, _TargetConfig> {
@@ -235,7 +365,7 @@ private:
     void submit(_TargetConfig& f_config) override {
         base_t::submit(f_config);
 
-        const auto loaded = this->m_is_default ? u64{0} : std::min(static_cast<u64>(_N), static_cast<u64>(this->m_entries.size()));
+        const auto loaded = this->m_is_default ? u64{0} : std::min(static_cast<u64>(_N), this->entries_count());
         f_config.*m_count_member_ptr = static_cast<_CountType>(loaded);
     }
 
@@ -243,6 +373,15 @@ private:
         return std::make_unique<CArrayCountField<_Object, _N, _TargetConfig, _CountType>>(*this);
     }
 
+    void serialize(const _TargetConfig& f_config, JsonWriter& f_writer) const override {
+        this->serialize_entries(f_config, std::min<u64>(_N, static_cast<u64>(f_config.*m_count_member_ptr)), f_writer);
+    }
+
+    void hash_schema(SchemaHasher& f_hasher) const override {
+        f_hasher.add_type<CArrayCountField<_Object, _N, _TargetConfig, _CountType>>();
+        base_t::hash_schema(f_hasher);
+    }
+
 private:
     count_member_ptr_t m_count_member_ptr;
 };
@@ -59,6 +59,7 @@ struct is_string_buffer<char[_N]> {
 
 template <typename _Field>
 concept CStringValueFieldType = __is_same(_Field, std::string)
+                             || __is_same(_Field, std::string_view)
                              || is_string_buffer<_Field>::value;
 
 template <typename _Field>
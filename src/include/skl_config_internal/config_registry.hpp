@@ -0,0 +1,262 @@
+//!
+//! \file config_registry
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define SKL_LOG_TAG ""
+
+//! \remark Included at the end of skl_config, after ConfigNode is complete
+namespace skl::config {
+//! Outcome of one registered config root
+struct registry_entry_report_t {
+    std::string              m_name;
+    u64                      m_start_ns{0ULL};    //!< Relative to the start of load_all()
+    u64                      m_duration_ns{0ULL}; //!< 0 if skipped
+    bool                     m_loaded{false};
+    std::vector<std::string> m_errors{};
+};
+
+//! Outcome of ConfigRegistry::load_all()
+struct registry_report_t {
+    std::vector<registry_entry_report_t> m_entries;             //!< In registration order
+    std::vector<std::string>             m_critical_path;       //!< Longest dependency chain (by load time), first to last
+    u64                                  m_critical_path_ns{0ULL};
+    u64                                  m_sum_ns{0ULL};        //!< Sum of all load times (the sequential cost)
+    u64                                  m_wall_ns{0ULL};
+};
+} // namespace skl::config
+
+namespace skl {
+//! Loads many independent config roots concurrently, respecting their declared dependencies
+//! \remark A root is loaded as soon as all its dependencies are loaded, startup takes the longest chain instead of the sum
+class ConfigRegistry {
+    struct entry_t {
+        std::string              m_name;
+        std::function<void()>    m_load;
+        std::vector<std::string> m_dependencies;
+    };
+
+    struct state_t {
+        std::vector<u32>  m_dependents;
+        std::atomic<u32>  m_remaining{0U};
+        std::atomic<bool> m_dependency_failed{false};
+    };
+
+public:
+    //! Register a config root loaded from \p f_file into \p f_out_config
+    //! \param f_dependencies Names of the roots that must be loaded before this one (eg. read by its post_submit)
+    //! \remark The loader and the target must outlive load_all() and must not be shared with other entries
+    template <config::CConfigTargetType _TargetConfig>
+    ConfigRegistry& add(std::string_view                        f_name,
+                        ConfigNode<_TargetConfig>&              f_loader,
+                        std::string_view                        f_file,
+                        _TargetConfig&                          f_out_config,
+                        std::initializer_list<std::string_view> f_dependencies = {}) {
+        return add(f_name, [&f_loader, file = std::string{f_file}, &f_out_config]() {
+            f_loader.load_validate_and_submit(skl_string_view::from_std(std::string_view{file}), f_out_config);
+        }, f_dependencies);
+    }
+
+    //! Register a custom load step
+    //! \remark (void) -> void, throws on failure
+    ConfigRegistry& add(std::string_view f_name, std::function<void()> f_load, std::initializer_list<std::string_view> f_dependencies = {}) {
+        auto& entry  = m_entries.emplace_back();
+        entry.m_name = f_name;
+        entry.m_load = std::move(f_load);
+        for (const auto dependency : f_dependencies) {
+            entry.m_dependencies.emplace_back(dependency);
+        }
+        return *this;
+    }
+
+    //! Load all registered roots, independent ones concurrently on the executor
+    //! \remark Roots depending on a failed root are skipped, throws after all roots finished if any failed
+    void load_all(config::Executor& f_executor = config::default_executor()) {
+        const auto count  = static_cast<u32>(m_entries.size());
+        auto       states = std::make_unique<state_t[]>(count);
+
+        build_graph(states.get());
+
+        m_report                = {};
+        m_report.m_entries.resize(count);
+        for (u32 i = 0U; i < count; ++i) {
+            m_report.m_entries[i].m_name = m_entries[i].m_name;
+        }
+
+        m_start = std::chrono::steady_clock::now();
+
+        std::vector<std::function<void()>> roots{};
+        for (u32 i = 0U; i < count; ++i) {
+            if (0U == states[i].m_remaining.load(std::memory_order_relaxed)) {
+                roots.emplace_back([this, &f_executor, &states, i]() noexcept { run_entry(f_executor, states.get(), i); });
+            }
+        }
+
+        f_executor.run(roots);
+
+        m_report.m_wall_ns = elapsed_ns();
+        build_critical_path();
+
+        for (const auto& entry : m_report.m_entries) {
+            if (false == entry.m_loaded) {
+                SERROR_LOCAL_T("Config \"{}\" failed to load!", skl_string_view::from_std(std::string_view{entry.m_name}));
+                throw std::runtime_error("Config registry load failed!");
+            }
+        }
+    }
+
+    //! Timings, outcomes and critical path of the last load_all()
+    [[nodiscard]] const config::registry_report_t& report() const noexcept {
+        return m_report;
+    }
+
+private:
+    void build_graph(state_t* f_states) {
+        std::unordered_map<std::string_view, u32> indices{};
+        for (u32 i = 0U; i < m_entries.size(); ++i) {
+            if (false == indices.emplace(m_entries[i].m_name, i).second) {
+                SERROR_LOCAL_T("Config \"{}\" is registered twice!", skl_string_view::from_std(std::string_view{m_entries[i].m_name}));
+                throw std::runtime_error("Duplicate config registry entry!");
+            }
+        }
+
+        for (u32 i = 0U; i < m_entries.size(); ++i) {
+            for (const auto& dependency : m_entries[i].m_dependencies) {
+                const auto it = indices.find(dependency);
+                if (indices.end() == it) {
+                    SERROR_LOCAL_T("Config \"{}\" depends on unknown config \"{}\"!",
+                                   skl_string_view::from_std(std::string_view{m_entries[i].m_name}),
+                                   skl_string_view::from_std(std::string_view{dependency}));
+                    throw std::runtime_error("Unknown config registry dependency!");
+                }
+
+                f_states[it->second].m_dependents.push_back(i);
+                f_states[i].m_remaining.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+
+        // Kahn, every entry must be reachable from the roots
+        std::vector<u32> remaining(m_entries.size());
+        std::vector<u32> ready{};
+        for (u32 i = 0U; i < m_entries.size(); ++i) {
+            remaining[i] = f_states[i].m_remaining.load(std::memory_order_relaxed);
+            if (0U == remaining[i]) {
+                ready.push_back(i);
+            }
+        }
+
+        m_order.clear();
+        while (false == ready.empty()) {
+            const auto index = ready.back();
+            ready.pop_back();
+            m_order.push_back(index);
+
+            for (const auto dependent : f_states[index].m_dependents) {
+                if (0U == --remaining[dependent]) {
+                    ready.push_back(dependent);
+                }
+            }
+        }
+
+        if (m_order.size() != m_entries.size()) {
+            SERROR_LOCAL_T("Config registry has a dependency cycle! ({} of {} configs reachable)", m_order.size(), m_entries.size());
+            throw std::runtime_error("Config registry dependency cycle!");
+        }
+    }
+
+    void run_entry(config::Executor& f_executor, state_t* f_states, u32 f_index) noexcept {
+        auto& report = m_report.m_entries[f_index];
+
+        if (f_states[f_index].m_dependency_failed.load(std::memory_order_acquire)) {
+            report.m_errors.emplace_back("Skipped, a dependency failed to load!");
+        } else {
+            report.m_start_ns = elapsed_ns();
+
+            config::DiagnosticsScope scope{report.m_errors};
+            try {
+                m_entries[f_index].m_load();
+                report.m_loaded = true;
+            } catch (const std::exception& f_ex) {
+                report.m_errors.emplace_back(f_ex.what());
+            } catch (...) {
+                report.m_errors.emplace_back("Unknown error!");
+            }
+
+            report.m_duration_ns = elapsed_ns() - report.m_start_ns;
+        }
+
+        // Release the dependents that became ready, the last finished dependency starts them
+        std::vector<std::function<void()>> ready{};
+        for (const auto dependent : f_states[f_index].m_dependents) {
+            if (false == report.m_loaded) {
+                f_states[dependent].m_dependency_failed.store(true, std::memory_order_release);
+            }
+
+            if (1U == f_states[dependent].m_remaining.fetch_sub(1U, std::memory_order_acq_rel)) {
+                ready.emplace_back([this, &f_executor, f_states, dependent]() noexcept { run_entry(f_executor, f_states, dependent); });
+            }
+        }
+
+        f_executor.run(ready);
+    }
+
+    void build_critical_path() {
+        const auto count = m_report.m_entries.size();
+
+        std::unordered_map<std::string_view, u32> indices{};
+        for (u32 i = 0U; i < count; ++i) {
+            indices.emplace(m_entries[i].m_name, i);
+        }
+
+        // Longest chain ending at each entry, in topological order
+        std::vector<u64> chain_ns(count, 0ULL);
+        std::vector<i64> previous(count, -1);
+        for (const auto index : m_order) {
+            u64 longest = 0ULL;
+            for (const auto& dependency : m_entries[index].m_dependencies) {
+                const auto dependency_index = indices[dependency];
+                if (chain_ns[dependency_index] >= longest) {
+                    longest         = chain_ns[dependency_index];
+                    previous[index] = dependency_index;
+                }
+            }
+
+            chain_ns[index] = longest + m_report.m_entries[index].m_duration_ns;
+            m_report.m_sum_ns += m_report.m_entries[index].m_duration_ns;
+        }
+
+        if (0ULL == count) {
+            return;
+        }
+
+        i64 current = static_cast<i64>(std::max_element(chain_ns.begin(), chain_ns.end()) - chain_ns.begin());
+        m_report.m_critical_path_ns = chain_ns[current];
+        while (-1 != current) {
+            m_report.m_critical_path.insert(m_report.m_critical_path.begin(), m_entries[current].m_name);
+            current = previous[current];
+        }
+    }
+
+    [[nodiscard]] u64 elapsed_ns() const noexcept {
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count());
+    }
+
+private:
+    std::vector<entry_t>                  m_entries;
+    std::vector<u32>                      m_order; //!< Topological order of m_entries
+    config::registry_report_t             m_report;
+    std::chrono::steady_clock::time_point m_start;
+};
+} // namespace skl
+
+#undef SKL_LOG_TAG
@@ -0,0 +1,67 @@
+//!
+//! \file diagnostics
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace skl::config {
+//! Collects the field errors reported on the current thread while alive, scopes nest
+class DiagnosticsScope {
+public:
+    //! \param f_print false to collect the errors without printing them (eg. on a worker thread, the caller replays them)
+    explicit DiagnosticsScope(std::vector<std::string>& f_out_errors, bool f_print = true) noexcept
+        : m_previous(t_current)
+        , m_previous_print(t_print) {
+        t_current = &f_out_errors;
+        t_print   = f_print;
+    }
+
+    ~DiagnosticsScope() noexcept {
+        t_current = m_previous;
+        t_print   = m_previous_print;
+    }
+
+    DiagnosticsScope(const DiagnosticsScope&)                = delete;
+    DiagnosticsScope& operator=(const DiagnosticsScope&)     = delete;
+    DiagnosticsScope(DiagnosticsScope&&) noexcept            = delete;
+    DiagnosticsScope& operator=(DiagnosticsScope&&) noexcept = delete;
+
+    [[nodiscard]] static std::vector<std::string>* current() noexcept {
+        return t_current;
+    }
+
+    [[nodiscard]] static bool printing() noexcept {
+        return t_print;
+    }
+
+private:
+    inline static thread_local std::vector<std::string>* t_current{nullptr};
+    inline static thread_local bool                      t_print{true};
+
+    std::vector<std::string>* m_previous;
+    bool                      m_previous_print;
+};
+
+//! Report a field error, printed and collected by the active DiagnosticsScope (if any)
+inline void report_error(const char* f_error) {
+    if (DiagnosticsScope::printing()) {
+        puts(f_error);
+    }
+
+    if (auto* errors = DiagnosticsScope::current(); nullptr != errors) {
+        errors->emplace_back(f_error);
+    }
+}
+
+//! Report the errors collected (without printing) on another thread, in order
+inline void replay_errors(const std::vector<std::string>& f_errors) {
+    for (const auto& error : f_errors) {
+        report_error(error.c_str());
+    }
+}
+} // namespace skl::config
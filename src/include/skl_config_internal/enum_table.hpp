@@ -0,0 +1,205 @@
+//!
+//! \file enum_table
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <optional>
+#include <string_view>
+
+#include <skl_magic_enum>
+
+#include "skl_config_internal/common.hpp"
+
+namespace skl::config {
+namespace enum_table_detail {
+    [[nodiscard]] constexpr u64 hash_name(std::string_view f_name) noexcept {
+        u64 hash = 0xCBF29CE484222325ULL;
+        for (const char c : f_name) {
+            hash ^= static_cast<u8>(c);
+            hash *= 0x100000001B3ULL;
+        }
+
+        return hash;
+    }
+
+    //! Slot of a name hash for the given bucket seed
+    [[nodiscard]] constexpr u64 slot_hash(u64 f_hash, u64 f_seed) noexcept {
+        f_hash ^= f_seed * 0x9E3779B97F4A7C15ULL;
+        f_hash ^= f_hash >> 32U;
+        f_hash *= 0xD6E8FEB86659FD93ULL;
+        f_hash ^= f_hash >> 32U;
+        return f_hash;
+    }
+
+    //! Called (at compile time) when no seed was found, not a constant expression so it stops the build
+    inline void perfect_hash_not_found() noexcept { }
+} // namespace enum_table_detail
+
+//! Compile time tables of an enum: perfect hash from enumerator names, dense enumerator indices and bitmaps over them
+//! \remark The hash is two level (hash and displace): the name hash picks a bucket, the bucket's seed picks the slot
+//! \remark Lookup is one name hash, one slot mix, one string compare
+template <CEnumValueFieldType _Type>
+class EnumTable {
+public:
+    using underlying_t = __underlying_type(_Type);
+
+    static constexpr auto CValues = magic_enum::enum_values<_Type>(); //!< Sorted by value
+    static constexpr auto CNames  = magic_enum::enum_names<_Type>();
+
+    static constexpr u64 CCount   = CValues.size();
+    static constexpr u64 CSlots   = std::bit_ceil(CCount * 2ULL + 1ULL);
+    static constexpr u64 CBuckets = std::bit_ceil(CCount / 2ULL + 1ULL);
+
+    //! One bit per enumerator (by index)
+    using bitmap_t = std::array<u64, (CCount + 63ULL) / 64ULL>;
+
+    struct table_t {
+        std::array<u32, CBuckets> m_seeds{};
+        std::array<u32, CSlots>   m_slots{}; //!< Enumerator index + 1, 0 = empty
+    };
+
+    //! Enumerator of the given name (exact match), nullopt if none
+    [[nodiscard]] static constexpr std::optional<_Type> find(std::string_view f_name) noexcept {
+        const auto index = index_of_name(f_name);
+        if (false == index.has_value()) {
+            return std::nullopt;
+        }
+
+        return CValues[index.value()];
+    }
+
+    //! Index of the enumerator of the given name, nullopt if none
+    [[nodiscard]] static constexpr std::optional<u64> index_of_name(std::string_view f_name) noexcept {
+        const auto hash  = enum_table_detail::hash_name(f_name);
+        const auto seed  = CTable.m_seeds[hash & (CBuckets - 1ULL)];
+        const auto entry = CTable.m_slots[enum_table_detail::slot_hash(hash, seed) & (CSlots - 1ULL)];
+        if ((0U == entry) || (CNames[entry - 1U] != f_name)) {
+            return std::nullopt;
+        }
+
+        return static_cast<u64>(entry - 1U);
+    }
+
+    //! Index of the enumerator of the given value, nullopt if the value is not an enumerator
+    [[nodiscard]] static constexpr std::optional<u64> index_of(_Type f_value) noexcept {
+        if constexpr (0ULL == CCount) {
+            return std::nullopt;
+        } else if constexpr (CIsContiguous) {
+            const auto offset = static_cast<i64>(static_cast<underlying_t>(f_value)) - static_cast<i64>(static_cast<underlying_t>(CValues[0]));
+            if ((offset < 0) || (static_cast<u64>(offset) >= CCount)) {
+                return std::nullopt;
+            }
+
+            return static_cast<u64>(offset);
+        } else {
+            // Sorted values, binary search
+            u64 begin = 0ULL;
+            u64 end   = CCount;
+            while (begin < end) {
+                const auto middle = begin + ((end - begin) / 2ULL);
+                if (static_cast<underlying_t>(CValues[middle]) < static_cast<underlying_t>(f_value)) {
+                    begin = middle + 1ULL;
+                } else {
+                    end = middle;
+                }
+            }
+
+            if ((begin < CCount) && (CValues[begin] == f_value)) {
+                return begin;
+            }
+
+            return std::nullopt;
+        }
+    }
+
+    [[nodiscard]] static constexpr bool test(const bitmap_t& f_bitmap, u64 f_index) noexcept {
+        return 0ULL != (f_bitmap[f_index / 64ULL] & (1ULL << (f_index % 64ULL)));
+    }
+
+    static constexpr void set(bitmap_t& f_bitmap, u64 f_index, bool f_value) noexcept {
+        if (f_value) {
+            f_bitmap[f_index / 64ULL] |= (1ULL << (f_index % 64ULL));
+        } else {
+            f_bitmap[f_index / 64ULL] &= ~(1ULL << (f_index % 64ULL));
+        }
+    }
+
+private:
+    [[nodiscard]] static consteval bool is_contiguous() noexcept {
+        for (u64 i = 1ULL; i < CCount; ++i) {
+            if (static_cast<i64>(static_cast<underlying_t>(CValues[i])) != (static_cast<i64>(static_cast<underlying_t>(CValues[0])) + static_cast<i64>(i))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] static consteval table_t build() noexcept {
+        table_t                      table{};
+        std::array<u64, CCount + 1U> hashes{};
+        std::array<u64, CBuckets>    sizes{};
+        u64                          max_size = 0ULL;
+        for (u64 i = 0ULL; i < CCount; ++i) {
+            hashes[i] = enum_table_detail::hash_name(CNames[i]);
+            max_size  = std::max<u64>(max_size, ++sizes[hashes[i] & (CBuckets - 1ULL)]);
+        }
+
+        // Place the largest buckets first, they are the hardest to fit
+        std::array<u64, CCount + 1U> bucket_slots{};
+        for (u64 size = max_size; size > 0ULL; --size) {
+            for (u64 bucket = 0ULL; bucket < CBuckets; ++bucket) {
+                if (size != sizes[bucket]) {
+                    continue;
+                }
+
+                for (u32 seed = 1U;; ++seed) {
+                    if (seed > 1000000U) {
+                        enum_table_detail::perfect_hash_not_found();
+                    }
+
+                    u64  placed = 0ULL;
+                    bool fits   = true;
+                    for (u64 i = 0ULL; fits && (i < CCount); ++i) {
+                        if (bucket != (hashes[i] & (CBuckets - 1ULL))) {
+                            continue;
+                        }
+
+                        const auto slot = enum_table_detail::slot_hash(hashes[i], seed) & (CSlots - 1ULL);
+                        fits            = (0U == table.m_slots[slot]);
+                        for (u64 j = 0ULL; fits && (j < placed); ++j) {
+                            fits = (slot != bucket_slots[j]);
+                        }
+
+                        bucket_slots[placed++] = slot;
+                    }
+
+                    if (false == fits) {
+                        continue;
+                    }
+
+                    placed = 0ULL;
+                    for (u64 i = 0ULL; i < CCount; ++i) {
+                        if (bucket == (hashes[i] & (CBuckets - 1ULL))) {
+                            table.m_slots[bucket_slots[placed++]] = static_cast<u32>(i + 1ULL);
+                        }
+                    }
+
+                    table.m_seeds[bucket] = seed;
+                    break;
+                }
+            }
+        }
+
+        return table;
+    }
+
+    static constexpr bool    CIsContiguous = is_contiguous();
+    static constexpr table_t CTable        = build();
+};
+} // namespace skl::config
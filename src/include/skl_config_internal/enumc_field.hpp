@@ -10,6 +10,7 @@
 #include <skl_log>
 #include <skl_magic_enum>
 
+#include "skl_config_internal/enum_table.hpp"
 #include "skl_config_internal/field.hpp"
 
 #define SKL_LOG_TAG ""
@@ -20,7 +21,8 @@ class EnumField;
 
 template <typename _Type, typename _Functor>
 concept CEnumFieldParseRawFunctor = __is_class(_Functor)
-                                 && std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, const std::string&>;
+                                 && (std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, std::string_view>
+                                     || std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, const std::string&>);
 
 template <typename _Type, typename _Functor>
 concept CEnumFieldConstraintFunctor = __is_class(_Functor)
@@ -28,7 +30,7 @@ concept CEnumFieldConstraintFunctor = __is_class(_Functor)
 
 template <typename _Type, typename _Functor>
 concept CEnumFieldParseJsonFunctor = __is_class(_Functor)
-                                  && std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, json&>;
+                                  && std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, const json&>;
 
 template <typename _Type, typename _Functor>
 concept CEnumFieldPostLoadFunctor = __is_class(_Functor)
@@ -43,15 +45,17 @@ class EnumField : public ConfigField<_TargetConfig> {
 public:
     using member_ptr_t   = _Type _TargetConfig::*;
     using constraints_t  = std::vector<std::function<bool(Field&, _Type)>>;
-    using raw_parsert_t  = std::function<std::optional<_Type>(Field&, const std::string&)>;
-    using json_parsert_t = std::function<std::optional<_Type>(Field&, json&)>;
+    using raw_parsert_t  = std::function<std::optional<_Type>(Field&, std::string_view)>;
+    using json_parsert_t = std::function<std::optional<_Type>(Field&, const json&)>;
     using post_load_t    = std::function<bool(Field&, _Type)>;
     using pre_submit_t   = std::function<bool(Field&, _Type, _TargetConfig&)>;
     using underlying_t   = __underlying_type(_Type);
+    using enum_table_t   = EnumTable<_Type>;
 
     EnumField(Field* f_parent, std::string_view f_field_name, member_ptr_t f_member_ptr) noexcept
         : ConfigField<_TargetConfig>(f_parent, f_field_name)
         , m_member_ptr(f_member_ptr) {
+        update_allowed_bits();
     }
 
     ~EnumField() override                      = default;
@@ -82,7 +86,14 @@ public:
     template <typename _Functor>
         requires(CEnumFieldParseRawFunctor<_Type, _Functor>)
     EnumField& parse_raw(_Functor&& f_functor) {
-        m_custom_raw_parser = std::forward<_Functor>(f_functor);
+        if constexpr (std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, std::string_view>) {
+            m_custom_raw_parser = std::forward<_Functor>(f_functor);
+        } else {
+            // Takes a std::string, copy the raw value for it
+            m_custom_raw_parser = [functor = std::forward<_Functor>(f_functor)](Field& f_self, std::string_view f_string) mutable {
+                return functor(f_self, std::string{f_string});
+            };
+        }
         return *this;
     }
 
@@ -91,12 +102,18 @@ public:
     template <typename _Functor>
         requires(CEnumFieldParseRawFunctor<_Type, _Functor>)
     EnumField& parse_raw() {
-        m_custom_raw_parser = raw_parsert_t(&_Functor::operator());
+        if constexpr (std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, std::string_view>) {
+            m_custom_raw_parser = raw_parsert_t(&_Functor::operator());
+        } else {
+            m_custom_raw_parser = [](Field& f_self, std::string_view f_string) {
+                return _Functor::operator()(f_self, std::string{f_string});
+            };
+        }
         return *this;
     }
 
     //! Set custom json node parser
-    //! \remark (Field& f_self, json& f_json) -> std::optional<_Type>
+    //! \remark (Field& f_self, const json& f_json) -> std::optional<_Type>
     template <typename _Functor>
         requires(CEnumFieldParseJsonFunctor<_Type, _Functor>)
     EnumField& parse_json(_Functor&& f_functor) {
@@ -105,7 +122,7 @@ public:
     }
 
     //! Set custom json node parser
-    //! \remark (Field& f_self, json& f_json) static -> std::optional<_Type>
+    //! \remark (Field& f_self, const json& f_json) static -> std::optional<_Type>
     template <typename _Functor>
         requires(CEnumFieldParseJsonFunctor<_Type, _Functor>)
     EnumField& parse_json() {
@@ -156,6 +173,7 @@ public:
         }
 
         m_excluded_values.push_back(static_cast<underlying_t>(f_enum_value_to_exclude));
+        update_allowed_bits();
 
         return *this;
     }
@@ -167,6 +185,7 @@ public:
         }
 
         m_allowed_values.push_back(static_cast<underlying_t>(f_enum_value_to_allow));
+        update_allowed_bits();
 
         return *this;
     }
@@ -187,6 +206,7 @@ public:
         }
 
         m_min = static_cast<underlying_t>(f_min_enum);
+        update_allowed_bits();
 
         return *this;
     }
@@ -207,6 +227,7 @@ public:
         }
 
         m_max = static_cast<underlying_t>(f_max_enum);
+        update_allowed_bits();
 
         return *this;
     }
@@ -244,16 +265,18 @@ public:
     }
 
 protected:
-    void load(json& f_json) override {
-        bool  exists   = false;
-        json* src_json = nullptr;
+    void load(const json& f_json) override {
+        bool        exists   = false;
+        const json* src_json = nullptr;
 
         if (f_json.is_string()) {
             exists   = true;
             src_json = &f_json;
         } else {
-            exists   = f_json.contains(this->name());
-            src_json = &f_json[this->name()];
+            // Lookup only, the json is shared with other fields (possibly loading in parallel)
+            const auto it = f_json.find(this->name());
+            exists        = f_json.end() != it;
+            src_json      = exists ? &(*it) : nullptr;
         }
 
         if (exists) {
@@ -264,14 +287,14 @@ protected:
 
             if (false == m_custom_json_parser.has_value()) {
                 if (m_custom_raw_parser.has_value()) {
-                    const auto result = m_custom_raw_parser.value()(*this, src_json->template get<std::string>());
+                    const auto result = m_custom_raw_parser.value()(*this, json_string_view(*src_json));
                     if (false == result.has_value()) {
                         throw std::runtime_error("Custom parsing for enum field failed!");
                     }
 
                     m_value = result;
                 } else {
-                    const auto result = enum_from_string<_Type>(src_json->template get<std::string>());
+                    const auto result = enum_table_t::find(json_string_view(*src_json));
                     if (false == result.has_value()) {
                         SERROR_LOCAL_T("Enum field \"{}\" has invalid value({})!",
                                        this->path_name().c_str(),
@@ -324,7 +347,7 @@ protected:
         }
 
         if ((false == m_is_default) || m_validate_if_default || false == m_is_validation_only) {
-            if (false == is_valid_value(static_cast<underlying_t>(m_value.value()))) {
+            if (false == is_allowed(m_value.value())) {
                 const auto enum_value_str = enum_to_string(m_value.value());
                 SERROR_LOCAL_T("Invalid value({}) for enum field \"{}\"!", enum_value_str, this->path_name().c_str());
                 print_allowed();
@@ -377,23 +400,71 @@ protected:
         return std::make_unique<EnumField<_Type, _TargetConfig>>(*this);
     }
 
+    void serialize(const _TargetConfig& f_config, JsonWriter& f_writer) const override {
+        f_writer.key(this->name());
+        serialize_value(f_config.*m_member_ptr, f_writer);
+    }
+
+    //! Write a value of this field as json, the enumerator name (the underlying value if it is not an enumerator)
+    static void serialize_value(_Type f_value, JsonWriter& f_writer) {
+        const auto index = enum_table_t::index_of(f_value);
+        if (index.has_value()) {
+            (void)f_writer.value(enum_table_t::CNames[index.value()]);
+        } else {
+            (void)f_writer.value(static_cast<underlying_t>(f_value));
+        }
+    }
+
+    void hash_schema(SchemaHasher& f_hasher) const override {
+        f_hasher.add_type<EnumField<_Type, _TargetConfig>>();
+        f_hasher.add_string(this->name());
+        f_hasher.add_optional(m_default);
+        f_hasher.add_optional(m_min);
+        f_hasher.add_optional(m_max);
+        f_hasher.add(m_excluded_values.size());
+        for (const auto value : m_excluded_values) {
+            f_hasher.add_value(value);
+        }
+        f_hasher.add(m_allowed_values.size());
+        for (const auto value : m_allowed_values) {
+            f_hasher.add_value(value);
+        }
+        f_hasher.add(m_required);
+        f_hasher.add(m_validate_if_default);
+        f_hasher.add(m_constraints.size());
+        f_hasher.add(m_custom_raw_parser.has_value());
+        f_hasher.add(m_custom_json_parser.has_value());
+        f_hasher.add(m_post_load.has_value());
+        f_hasher.add(m_pre_submit.has_value());
+    }
+
+    void save_state(SnapshotWriter& f_writer) const override {
+        f_writer.write_optional(m_value);
+        f_writer.write(m_is_default);
+    }
+
+    void load_state(SnapshotReader& f_reader) override {
+        m_value              = f_reader.read_optional<_Type>();
+        m_is_default         = f_reader.read<bool>();
+        m_is_validation_only = false;
+    }
+
     void print_allowed() {
         puts("\tAllowed values:");
-        for (_Type value : magic_enum::enum_values<_Type>()) {
-            if (is_valid_value<false>(static_cast<underlying_t>(value))) {
-                printf("\t\t%s\n", magic_enum::enum_name(value).data());
+        for (u64 i = 0ULL; i < enum_table_t::CCount; ++i) {
+            if (enum_table_t::test(m_allowed_bits, i)) {
+                printf("\t\t%.*s\n", static_cast<int>(enum_table_t::CNames[i].size()), enum_table_t::CNames[i].data());
             }
         }
     }
 
-    template <bool _CheckIfValidEnumEntry = true>
-    bool is_valid_value(underlying_t f_value) noexcept {
-        if constexpr (_CheckIfValidEnumEntry) {
-            if (false == magic_enum::enum_contains<_Type>(m_value.value())) {
-                return false;
-            }
-        }
+    //! Is the value an enumerator allowed by min, max, exclude and allowed (one index computation and one bit test)
+    [[nodiscard]] bool is_allowed(_Type f_value) const noexcept {
+        const auto index = enum_table_t::index_of(f_value);
+        return index.has_value() && enum_table_t::test(m_allowed_bits, index.value());
+    }
 
+    [[nodiscard]] bool is_valid_value(underlying_t f_value) const noexcept {
         if ((m_min.has_value() && f_value < m_min.value())
             || (m_max.has_value() && f_value > m_max.value())) {
             return false;
@@ -412,6 +483,13 @@ protected:
         return true;
     }
 
+    //! Precompute the allowed enumerators bitmap, after each min/max/exclude/allowed change
+    void update_allowed_bits() noexcept {
+        for (u64 i = 0ULL; i < enum_table_t::CCount; ++i) {
+            enum_table_t::set(m_allowed_bits, i, is_valid_value(static_cast<underlying_t>(enum_table_t::CValues[i])));
+        }
+    }
+
 private:
     std::optional<_Type>          m_value;
     std::optional<_Type>          m_default;
@@ -423,6 +501,7 @@ private:
     std::optional<pre_submit_t>   m_pre_submit;
     std::vector<underlying_t>     m_excluded_values;
     std::vector<underlying_t>     m_allowed_values;
+    enum_table_t::bitmap_t        m_allowed_bits{};
     member_ptr_t                  m_member_ptr;
     constraints_t                 m_constraints;
     bool                          m_required{false};
@@ -0,0 +1,303 @@
+//!
+//! \file executor
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "skl_config_internal/common.hpp"
+#include "skl_config_internal/diagnostics.hpp"
+
+namespace skl::config {
+//! Minimum estimated cost (~ number of json values) of a node or array before it is split across an executor
+constexpr u64 CParallelMinCost = 1024ULL;
+
+//! Pluggable executor used by the parallel load/validate mode
+class Executor {
+public:
+    Executor() noexcept                      = default;
+    virtual ~Executor()                      = default;
+    Executor(const Executor&)                = delete;
+    Executor& operator=(const Executor&)     = delete;
+    Executor(Executor&&) noexcept            = delete;
+    Executor& operator=(Executor&&) noexcept = delete;
+
+    //! Number of threads that can execute tasks concurrently (including the caller of run())
+    [[nodiscard]] virtual u32 concurrency() const noexcept = 0;
+
+    //! Execute all tasks and wait for them to complete
+    //! \remark Tasks must not throw and may call run() recursively, the caller must help execute while waiting
+    virtual void run(std::span<const std::function<void()>> f_tasks) = 0;
+
+    //! Execute the task asynchronously, the executor keeps it alive and finishes it before it is destroyed
+    //! \remark The task must not throw, executors without a queue of their own execute it right away (the default)
+    virtual void post(std::function<void()> f_task) {
+        f_task();
+    }
+};
+
+//! Fixed pool of workers with per-worker deques, idle workers (and waiting callers) steal from the others
+class WorkStealingExecutor final : public Executor {
+    struct batch_t {
+        std::atomic<u64> m_remaining;
+    };
+
+    struct task_t {
+        const std::function<void()>* m_task;
+        batch_t*                     m_batch; //!< nullptr for a posted task, m_task is then owned by the task
+    };
+
+    struct queue_t {
+        std::mutex         m_lock;
+        std::deque<task_t> m_tasks;
+    };
+
+public:
+    //! \param f_threads Total concurrency including the calling thread, 0 = hardware concurrency
+    explicit WorkStealingExecutor(u32 f_threads = 0U) {
+        if (0U == f_threads) {
+            f_threads = std::max(1U, std::thread::hardware_concurrency());
+        }
+
+        // The last queue is shared by all external (non worker) threads
+        m_queues.reserve(f_threads);
+        for (u32 i = 0U; i < f_threads; ++i) {
+            m_queues.emplace_back(std::make_unique<queue_t>());
+        }
+
+        m_threads.reserve(f_threads - 1U);
+        for (u32 i = 0U; i < (f_threads - 1U); ++i) {
+            m_threads.emplace_back([this, i]() noexcept { worker_main(i); });
+        }
+    }
+
+    //! The workers finish the queued (and posted) tasks before exiting
+    ~WorkStealingExecutor() override {
+        {
+            std::lock_guard guard{m_sleep_lock};
+            m_stop = true;
+        }
+        m_sleep_cv.notify_all();
+
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    [[nodiscard]] u32 concurrency() const noexcept override {
+        return static_cast<u32>(m_queues.size());
+    }
+
+    void run(std::span<const std::function<void()>> f_tasks) override {
+        if (f_tasks.empty()) {
+            return;
+        }
+
+        if ((1ULL == f_tasks.size()) || m_threads.empty()) {
+            for (const auto& task : f_tasks) {
+                task();
+            }
+            return;
+        }
+
+        batch_t    batch{f_tasks.size()};
+        const auto home = home_queue();
+
+        {
+            std::lock_guard guard{m_queues[home]->m_lock};
+            for (const auto& task : f_tasks) {
+                m_queues[home]->m_tasks.push_back(task_t{&task, &batch});
+            }
+        }
+
+        {
+            std::lock_guard guard{m_sleep_lock};
+            m_pending.fetch_add(static_cast<i64>(f_tasks.size()), std::memory_order_release);
+        }
+        m_sleep_cv.notify_all();
+
+        // Help while tasks are queued, this is what makes nested run() calls safe, sleep until the batch is done otherwise
+        while (0ULL != batch.m_remaining.load(std::memory_order_acquire)) {
+            task_t task;
+            if (try_take(home, task)) {
+                execute(task);
+                continue;
+            }
+
+            std::unique_lock lock{m_sleep_lock};
+            m_sleep_cv.wait(lock, [this, &batch]() noexcept {
+                return (0ULL == batch.m_remaining.load(std::memory_order_acquire)) || (0 < m_pending.load(std::memory_order_acquire));
+            });
+        }
+    }
+
+    void post(std::function<void()> f_task) override {
+        if (m_threads.empty()) {
+            f_task();
+            return;
+        }
+
+        // Queued on the shared external queue, any worker picks it up
+        auto       task  = std::make_unique<std::function<void()>>(std::move(f_task));
+        const auto queue = static_cast<u32>(m_queues.size() - 1ULL);
+        {
+            std::lock_guard guard{m_queues[queue]->m_lock};
+            m_queues[queue]->m_tasks.push_back(task_t{task.get(), nullptr});
+        }
+        (void)task.release();
+
+        {
+            std::lock_guard guard{m_sleep_lock};
+            m_pending.fetch_add(1, std::memory_order_release);
+        }
+        m_sleep_cv.notify_one();
+    }
+
+private:
+    void worker_main(u32 f_index) noexcept {
+        t_current = {this, f_index};
+
+        while (true) {
+            task_t task;
+            if (try_take(f_index, task)) {
+                execute(task);
+                continue;
+            }
+
+            std::unique_lock lock{m_sleep_lock};
+            m_sleep_cv.wait(lock, [this]() noexcept { return m_stop || (0 < m_pending.load(std::memory_order_acquire)); });
+            if (m_stop && (0 >= m_pending.load(std::memory_order_acquire))) {
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]] u32 home_queue() const noexcept {
+        if (this == t_current.m_owner) {
+            return t_current.m_index;
+        }
+
+        return static_cast<u32>(m_queues.size() - 1ULL);
+    }
+
+    //! Pop from the back of the own queue (LIFO, cache warm) or steal from the front of the others
+    [[nodiscard]] bool try_take(u32 f_home, task_t& f_out_task) noexcept {
+        {
+            auto&           queue = *m_queues[f_home];
+            std::lock_guard guard{queue.m_lock};
+            if (false == queue.m_tasks.empty()) {
+                f_out_task = queue.m_tasks.back();
+                queue.m_tasks.pop_back();
+                m_pending.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+        }
+
+        const auto count = static_cast<u32>(m_queues.size());
+        for (u32 i = 1U; i < count; ++i) {
+            auto&           queue = *m_queues[(f_home + i) % count];
+            std::lock_guard guard{queue.m_lock};
+            if (false == queue.m_tasks.empty()) {
+                f_out_task = queue.m_tasks.front();
+                queue.m_tasks.pop_front();
+                m_pending.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void execute(const task_t& f_task) noexcept {
+        (*f_task.m_task)();
+
+        if (nullptr == f_task.m_batch) {
+            delete f_task.m_task;
+            return;
+        }
+
+        if (1ULL == f_task.m_batch->m_remaining.fetch_sub(1ULL, std::memory_order_acq_rel)) {
+            // Wake the caller of run(), taking the lock orders this with its wait predicate
+            {
+                std::lock_guard guard{m_sleep_lock};
+            }
+            m_sleep_cv.notify_all();
+        }
+    }
+
+private:
+    struct current_t {
+        const WorkStealingExecutor* m_owner;
+        u32                         m_index;
+    };
+
+    inline static thread_local current_t t_current{nullptr, 0U};
+
+    std::vector<std::unique_ptr<queue_t>> m_queues;
+    std::vector<std::thread>              m_threads;
+    std::atomic<i64>                      m_pending{0};
+    std::mutex                            m_sleep_lock;
+    std::condition_variable               m_sleep_cv;
+    bool                                  m_stop{false};
+};
+
+//! Process wide work stealing executor (hardware concurrency), created on first use
+[[nodiscard]] inline Executor& default_executor() {
+    static WorkStealingExecutor executor{};
+    return executor;
+}
+
+//! Split [0, f_count) into chunks of at least f_grain elements and run f_body(begin, end) for each chunk on the executor
+//! \remark All chunks run to completion, then the failure of the lowest failing chunk (if any) is rethrown
+//! \remark Errors reported by the chunks (up to the lowest failing one) are replayed on the calling thread, in chunk order
+template <typename _Body>
+void parallel_for(Executor& f_executor, u64 f_count, u64 f_grain, _Body&& f_body) {
+    const auto chunks = std::max<u64>(1ULL, std::min<u64>(f_count / std::max<u64>(1ULL, f_grain), f_executor.concurrency() * 4ULL));
+    const auto step   = (f_count + chunks - 1ULL) / chunks;
+
+    std::vector<std::exception_ptr>       errors(chunks);
+    std::vector<std::vector<std::string>> diagnostics(chunks);
+    std::vector<std::function<void()>>    tasks;
+    tasks.reserve(chunks);
+
+    for (u64 i = 0ULL; i < chunks; ++i) {
+        const auto begin = i * step;
+        const auto end   = std::min<u64>(f_count, begin + step);
+        if (begin >= end) {
+            break;
+        }
+
+        tasks.emplace_back([&f_body, &errors, &diagnostics, i, begin, end]() noexcept {
+            DiagnosticsScope scope{diagnostics[i], false};
+            try {
+                f_body(begin, end);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+
+    f_executor.run(tasks);
+
+    // Same diagnostics as a sequential loop, which stops at the first failure
+    for (u64 i = 0ULL; i < chunks; ++i) {
+        replay_errors(diagnostics[i]);
+        if (nullptr != errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+    }
+}
+} // namespace skl::config
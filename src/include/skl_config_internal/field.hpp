@@ -8,6 +8,13 @@
 #include <nlohmann/json.hpp>
 
 #include "skl_config_internal/common.hpp"
+#include "skl_config_internal/executor.hpp"
+#include "skl_config_internal/json_scan.hpp"
+#include "skl_config_internal/json_writer.hpp"
+#include "skl_config_internal/length_limit.hpp"
+#include "skl_config_internal/path_filter.hpp"
+#include "skl_config_internal/snapshot.hpp"
+#include "skl_config_internal/string_arena.hpp"
 
 namespace skl {
 template <config::CConfigTargetType _TargetConfig>
@@ -53,6 +60,24 @@ public:
         return m_parent->path_name() + ":" + name_cstr();
     }
 
+    //! Executor used to load and validate this field in parallel, inherited from the parents (nullptr = sequential)
+    [[nodiscard]] virtual Executor* executor() const noexcept {
+        if (nullptr == m_parent) {
+            return nullptr;
+        }
+
+        return m_parent->executor();
+    }
+
+    //! Arena the std::string_view string targets are interned into, inherited from the parents (nullptr = none)
+    [[nodiscard]] virtual StringArena* string_arena() const noexcept {
+        if (nullptr == m_parent) {
+            return nullptr;
+        }
+
+        return m_parent->string_arena();
+    }
+
     virtual void reset() = 0;
 
 protected:
@@ -85,7 +110,7 @@ public:
 
 protected:
     //! Load the field value from json
-    virtual void load(json&) = 0;
+    virtual void load(const json&) = 0;
 
     //! Validate the field value
     virtual void validate() = 0;
@@ -102,6 +127,69 @@ protected:
     //! Clone this field
     virtual std::unique_ptr<ConfigField<_TargetConfig>> clone() = 0;
 
+    //! Write the member of the given config object as a json member (name and value)
+    virtual void serialize(const _TargetConfig&, JsonWriter&) const = 0;
+
+    //! Fold the field's schema (name, kind, type and options) into the fingerprint
+    virtual void hash_schema(SchemaHasher&) const = 0;
+
+    //! Write the validated (ready to submit) state
+    virtual void save_state(SnapshotWriter&) const = 0;
+
+    //! Restore the validated (ready to submit) state written by save_state()
+    virtual void load_state(SnapshotReader&) = 0;
+
+    //! Resumable load, called with f_step = 0, 1, 2... until it returns true (default: load() in one step)
+    virtual bool load_step(const json& f_json, u64 f_step) {
+        (void)f_step;
+        load(f_json);
+        return true;
+    }
+
+    //! Resumable validate, same protocol as load_step()
+    virtual bool validate_step(u64 f_step) {
+        (void)f_step;
+        validate();
+        return true;
+    }
+
+    //! Does this field load its value straight from the json source (eg. ArrayField::parallel_parse(), lazy fields)
+    //! \remark Only honored for the fields of the root node, the value is then cut out of the parsed json
+    [[nodiscard]] virtual bool loads_source() const noexcept {
+        return false;
+    }
+
+    //! Load the value from its [begin, end) range of the json source, instead of load()
+    virtual void load_source(std::string_view f_source, json_span_t f_value) {
+        (void)f_source;
+        (void)f_value;
+    }
+
+    //! Select the members of the nested node(s) to load (nullptr = all), see ConfigNode::apply_filter()
+    virtual void apply_filter(const path_filter_node_t* f_filter) {
+        (void)f_filter;
+    }
+
+    //! Add the max length of the (nested) streaming arrays to f_parent, checked while the source is parsed
+    virtual void collect_length_limits(length_limit_node_t& f_parent) const {
+        (void)f_parent;
+    }
+
+    //! Does a node of this field (nested ones included) run a post submit processor
+    [[nodiscard]] virtual bool has_post_submit() const noexcept {
+        return false;
+    }
+
+    //! Estimated cost (~ number of json values) of loading this field from the given (parent) json
+    [[nodiscard]] virtual u64 load_cost(const json&) const noexcept {
+        return 1ULL;
+    }
+
+    //! Estimated cost of validating the loaded value
+    [[nodiscard]] virtual u64 validate_cost() const noexcept {
+        return 1ULL;
+    }
+
     friend ConfigNode<_TargetConfig>;
 
     template <CConfigTargetType, CConfigTargetType, CContainerType>
@@ -115,5 +203,8 @@ protected:
 
     template <CPrimitiveValueFieldType, u32, CConfigTargetType, CIntegerValueFieldType>
     friend class CArrayCountField;
+
+protected:
+    bool m_is_filtered_out{false}; //!< Not selected by the active path filter, skipped by load, validate and submit
 };
 } // namespace skl::config
@@ -0,0 +1,65 @@
+//!
+//! \file instantiation
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+//! Explicit instantiation of the config templates for one target type
+//!
+//! The schema header of a config module declares the instantiations extern (every TU including it skips them):
+//!     SKL_CONFIG_EXTERN_TEMPLATES(my::MyConfig)
+//! and exactly one TU of the module instantiates them (see skl_config_instantiate() in SkylakeConfigInstantiate.cmake):
+//!     SKL_CONFIG_INSTANTIATE_TEMPLATES(my::MyConfig)
+//!
+//! \remark Both macros must be used at global namespace scope, after <skl_config> and the target type definition
+//! \remark Covers ConfigNode<T>, the scalar fields of T and the default-preprocessor load entry points,
+//!         other field kinds (eg. ObjectField<Child, T>) can be listed with SKL_CONFIG_EXTERN_TEMPLATE / SKL_CONFIG_INSTANTIATE_TEMPLATE
+//!
+#pragma once
+
+#include "skl_config_internal/common.hpp"
+
+namespace skl::config::instantiation {
+//! The skylake aliases as seen from namespace skl::config, the macros expand at global scope
+using i8_t  = i8;
+using u8_t  = u8;
+using i16_t = i16;
+using u16_t = u16;
+using i32_t = i32;
+using u32_t = u32;
+using i64_t = i64;
+using u64_t = u64;
+
+using string_view_t = skl_string_view;
+} // namespace skl::config::instantiation
+
+//! extern template class <...>; (commas in the template argument list are fine)
+#define SKL_CONFIG_EXTERN_TEMPLATE(...) extern template class __VA_ARGS__;
+
+//! template class <...>;
+#define SKL_CONFIG_INSTANTIATE_TEMPLATE(...) template class __VA_ARGS__;
+
+#define SKL_CONFIG_TEMPLATES_IMPL_(_Prefix, _Target)                                                                                 \
+    _Prefix class ::skl::ConfigNode<_Target>;                                                                                        \
+    _Prefix class ::skl::config::NumericField<::skl::config::instantiation::i8_t, _Target>;                                          \
+    _Prefix class ::skl::config::NumericField<::skl::config::instantiation::u8_t, _Target>;                                          \
+    _Prefix class ::skl::config::NumericField<::skl::config::instantiation::i16_t, _Target>;                                         \
+    _Prefix class ::skl::config::NumericField<::skl::config::instantiation::u16_t, _Target>;                                         \
+    _Prefix class ::skl::config::NumericField<::skl::config::instantiation::i32_t, _Target>;                                         \
+    _Prefix class ::skl::config::NumericField<::skl::config::instantiation::u32_t, _Target>;                                         \
+    _Prefix class ::skl::config::NumericField<::skl::config::instantiation::i64_t, _Target>;                                         \
+    _Prefix class ::skl::config::NumericField<::skl::config::instantiation::u64_t, _Target>;                                         \
+    _Prefix class ::skl::config::NumericField<float, _Target>;                                                                       \
+    _Prefix class ::skl::config::NumericField<double, _Target>;                                                                      \
+    _Prefix class ::skl::config::BooleanField<bool, _Target>;                                                                        \
+    _Prefix class ::skl::config::StringField<::std::string, _Target, false>;                                                         \
+    _Prefix class ::skl::config::StringField<::std::string_view, _Target, false>;                                                    \
+    _Prefix void  ::skl::ConfigNode<_Target>::load_validate_and_submit<::skl::ConfigNode<_Target>::null_json_preprocessor_t>(        \
+        ::skl::config::instantiation::string_view_t, _Target&, ::skl::ConfigNode<_Target>::null_json_preprocessor_t);                                          \
+    _Prefix void  ::skl::ConfigNode<_Target>::load_validate_and_submit_buffer<::skl::ConfigNode<_Target>::null_json_preprocessor_t>( \
+        ::std::span<const ::skl::config::instantiation::u8_t>, _Target&, ::skl::ConfigNode<_Target>::null_json_preprocessor_t);
+
+//! Declare the instantiations for _Target extern, put this in the schema header after the target type
+#define SKL_CONFIG_EXTERN_TEMPLATES(_Target) SKL_CONFIG_TEMPLATES_IMPL_(extern template, _Target)
+
+//! Instantiate the templates for _Target, put this in exactly one TU of the module
+#define SKL_CONFIG_INSTANTIATE_TEMPLATES(_Target) SKL_CONFIG_TEMPLATES_IMPL_(template, _Target)
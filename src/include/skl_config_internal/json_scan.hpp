@@ -0,0 +1,359 @@
+//!
+//! \file json_scan
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <charconv>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "skl_config_internal/common.hpp"
+
+namespace skl::config {
+//! [begin, end) byte range of a json value in the source
+struct json_span_t {
+    u64 m_begin;
+    u64 m_end;
+};
+
+//! Member of the top level json object
+struct json_member_t {
+    std::string_view m_key; //!< Raw (not unescaped) key
+    json_span_t      m_value;
+};
+
+//! Structural json scanner, finds value boundaries without decoding the values
+//! \remark Only tracks strings, nesting and comments, the values themselves are validated when parsed
+class JsonScanner {
+public:
+    explicit JsonScanner(std::string_view f_source) noexcept
+        : m_source(f_source) { }
+
+    //! Members of the top level object, nullopt if the source is not a (structurally valid) object
+    [[nodiscard]] std::optional<std::vector<json_member_t>> top_level_members() noexcept {
+        m_position = 0ULL;
+
+        // UTF-8 BOM
+        if (m_source.starts_with("\xEF\xBB\xBF")) {
+            m_position = 3ULL;
+        }
+
+        if (false == skip_whitespace()) {
+            return std::nullopt;
+        }
+
+        auto members = members_at_position();
+        if ((false == members.has_value()) || (false == skip_whitespace()) || (m_position != m_source.size())) {
+            return std::nullopt;
+        }
+
+        return members;
+    }
+
+    //! Members of the object at f_object, nullopt if it is not a (structurally valid) object
+    [[nodiscard]] std::optional<std::vector<json_member_t>> object_members(json_span_t f_object) noexcept {
+        m_position   = f_object.m_begin;
+        auto members = members_at_position();
+        if (m_position != f_object.m_end) {
+            return std::nullopt;
+        }
+
+        return members;
+    }
+
+    //! Elements of the array at f_array, nullopt if it is not a (structurally valid) array
+    //! \param f_max_count Stop at element f_max_count + 1 (the caller rejects the array), the rest is not scanned
+    [[nodiscard]] std::optional<std::vector<json_span_t>> array_elements(json_span_t f_array, u64 f_max_count = ~0ULL) noexcept {
+        m_position = f_array.m_begin;
+        if ((false == consume('[')) || (false == skip_whitespace())) {
+            return std::nullopt;
+        }
+
+        std::vector<json_span_t> elements{};
+        if (false == consume(']')) {
+            while (true) {
+                const auto begin = m_position;
+                if ((false == skip_value()) || (begin == m_position)) {
+                    return std::nullopt;
+                }
+
+                elements.push_back(json_span_t{begin, m_position});
+                if (elements.size() > f_max_count) {
+                    return elements;
+                }
+
+                if (false == skip_whitespace()) {
+                    return std::nullopt;
+                }
+
+                if (consume(']')) {
+                    break;
+                }
+
+                if ((false == consume(',')) || (false == skip_whitespace())) {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        if (m_position != f_array.m_end) {
+            return std::nullopt;
+        }
+
+        return elements;
+    }
+
+private:
+    [[nodiscard]] std::optional<std::vector<json_member_t>> members_at_position() noexcept {
+        if ((false == consume('{')) || (false == skip_whitespace())) {
+            return std::nullopt;
+        }
+
+        std::vector<json_member_t> members{};
+        if (consume('}')) {
+            return members;
+        }
+
+        while (true) {
+            const auto key_begin = m_position;
+            if (false == skip_string()) {
+                return std::nullopt;
+            }
+
+            const auto key = m_source.substr(key_begin + 1ULL, m_position - key_begin - 2ULL);
+            if ((false == skip_whitespace()) || (false == consume(':')) || (false == skip_whitespace())) {
+                return std::nullopt;
+            }
+
+            const auto value_begin = m_position;
+            if ((false == skip_value()) || (value_begin == m_position)) {
+                return std::nullopt;
+            }
+
+            members.push_back(json_member_t{key, json_span_t{value_begin, m_position}});
+
+            if (false == skip_whitespace()) {
+                return std::nullopt;
+            }
+
+            if (consume('}')) {
+                return members;
+            }
+
+            if ((false == consume(',')) || (false == skip_whitespace())) {
+                return std::nullopt;
+            }
+        }
+    }
+
+    [[nodiscard]] bool consume(char f_char) noexcept {
+        if ((m_position < m_source.size()) && (f_char == m_source[m_position])) {
+            ++m_position;
+            return true;
+        }
+
+        return false;
+    }
+
+    //! Skip whitespace and comments, false on an unterminated comment
+    [[nodiscard]] bool skip_whitespace() noexcept {
+        while (m_position < m_source.size()) {
+            const char c = m_source[m_position];
+            if ((' ' == c) || ('\t' == c) || ('\n' == c) || ('\r' == c)) {
+                ++m_position;
+            } else if ('/' == c) {
+                if (false == skip_comment()) {
+                    return false;
+                }
+            } else {
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool skip_comment() noexcept {
+        if ((m_position + 1ULL) >= m_source.size()) {
+            return false;
+        }
+
+        const char kind = m_source[m_position + 1ULL];
+        if ('/' == kind) {
+            const auto end = m_source.find('\n', m_position + 2ULL);
+            m_position     = (std::string_view::npos == end) ? m_source.size() : end + 1ULL;
+            return true;
+        }
+
+        if ('*' == kind) {
+            const auto end = m_source.find("*/", m_position + 2ULL);
+            if (std::string_view::npos == end) {
+                return false;
+            }
+
+            m_position = end + 2ULL;
+            return true;
+        }
+
+        return false;
+    }
+
+    //! Skip the string starting at the current position (must be '"')
+    [[nodiscard]] bool skip_string() noexcept {
+        if (false == consume('"')) {
+            return false;
+        }
+
+        while (true) {
+            const auto special = m_source.find_first_of("\"\\", m_position);
+            if (std::string_view::npos == special) {
+                return false;
+            }
+
+            if ('"' == m_source[special]) {
+                m_position = special + 1ULL;
+                return true;
+            }
+
+            // Escape, skip the escaped char
+            m_position = special + 2ULL;
+        }
+    }
+
+    //! Skip one value, containers are skipped by tracking the nesting depth
+    [[nodiscard]] bool skip_value() noexcept {
+        if (m_position >= m_source.size()) {
+            return false;
+        }
+
+        const char first = m_source[m_position];
+        if ('"' == first) {
+            return skip_string();
+        }
+
+        if (('{' != first) && ('[' != first)) {
+            // Scalar, up to the next delimiter
+            while ((m_position < m_source.size()) && (false == is_delimiter(m_source[m_position]))) {
+                ++m_position;
+            }
+            return true;
+        }
+
+        u64 depth = 0ULL;
+        while (m_position < m_source.size()) {
+            const char c = m_source[m_position];
+            if ('"' == c) {
+                if (false == skip_string()) {
+                    return false;
+                }
+                continue;
+            }
+
+            if ('/' == c) {
+                if (false == skip_comment()) {
+                    return false;
+                }
+                continue;
+            }
+
+            ++m_position;
+            if (('{' == c) || ('[' == c)) {
+                ++depth;
+            } else if (('}' == c) || (']' == c)) {
+                if (0ULL == --depth) {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] static bool is_delimiter(char f_char) noexcept {
+        return (',' == f_char) || ('}' == f_char) || (']' == f_char) || (' ' == f_char)
+            || ('\t' == f_char) || ('\n' == f_char) || ('\r' == f_char) || ('/' == f_char);
+    }
+
+private:
+    std::string_view m_source;
+    u64              m_position{0ULL};
+};
+
+//! Parse the json value at f_span of f_source
+[[nodiscard]] inline nlohmann::json parse_json_slice(std::string_view f_source, json_span_t f_span) {
+    return nlohmann::json::parse(f_source.substr(f_span.m_begin, f_span.m_end - f_span.m_begin),
+        /* callback */ nullptr,
+        /* allow_exceptions */ true,
+        /* ignore_comments */ true);
+}
+
+//! View of a json string value, no copy
+[[nodiscard]] inline std::string_view json_string_view(const nlohmann::json& f_json) {
+    return f_json.get_ref<const nlohmann::json::string_t&>();
+}
+
+//! Raw text of a json value as dump() would produce it, the string contents for strings
+//! \remark Strings are viewed in place and integers formatted into an inline buffer, floats, objects and arrays are dumped
+class JsonScalarText {
+public:
+    explicit JsonScalarText(const nlohmann::json& f_json) {
+        switch (f_json.type()) {
+            case nlohmann::json::value_t::string:
+                m_text = json_string_view(f_json);
+                break;
+            case nlohmann::json::value_t::boolean:
+                m_text = f_json.get<bool>() ? "true" : "false";
+                break;
+            case nlohmann::json::value_t::number_integer:
+                format(f_json.get<i64>());
+                break;
+            case nlohmann::json::value_t::number_unsigned:
+                format(f_json.get<u64>());
+                break;
+            case nlohmann::json::value_t::number_float:
+                format_float(f_json);
+                break;
+            case nlohmann::json::value_t::null:
+                m_text = "null";
+                break;
+            default:
+                m_storage = f_json.dump();
+                m_text    = m_storage;
+                break;
+        }
+    }
+
+    JsonScalarText(const JsonScalarText&)            = delete;
+    JsonScalarText& operator=(const JsonScalarText&) = delete;
+
+    [[nodiscard]] std::string_view view() const noexcept {
+        return m_text;
+    }
+
+private:
+    template <typename _Integer>
+    void format(_Integer f_value) noexcept {
+        const auto [end, ec] = std::to_chars(m_buffer, m_buffer + sizeof(m_buffer), f_value);
+        (void)ec;
+        m_text = std::string_view{m_buffer, static_cast<u64>(end - m_buffer)};
+    }
+
+    void format_float(const nlohmann::json& f_json) {
+        // Formatted by dump() itself (non finite values are null, 100000.0 stays "100000.0" where std::to_chars
+        // would give "1e+05"), the text fits the small string buffer for most values
+        m_storage = f_json.dump();
+        m_text    = m_storage;
+    }
+
+private:
+    char             m_buffer[24]; //!< Fits any 64 bit integer
+    std::string_view m_text;
+    std::string      m_storage; //!< Dump of a non scalar value
+};
+} // namespace skl::config
@@ -0,0 +1,267 @@
+//!
+//! \file json_writer
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include <unistd.h>
+
+#include <skl_log>
+
+#include "skl_config_internal/common.hpp"
+#include "skl_config_internal/simd.hpp"
+
+#define SKL_LOG_TAG ""
+
+namespace skl::config {
+//! Streaming (compact) json writer, into a growable buffer or a file descriptor
+//! \remark No DOM, numbers are formatted with to_chars and strings escaped with the vector kernels (see simd::find_json_escape())
+//! \remark The caller is responsible for the structure (keys inside objects, balanced begin/end)
+class JsonWriter {
+public:
+    //! Buffered bytes after which a file descriptor writer flushes
+    static constexpr u64 CDefaultFlushSize = 256ULL * 1024ULL;
+
+    //! Write into the buffer, see view() and take()
+    JsonWriter() noexcept = default;
+
+    //! Write into f_fd (not owned), flushed every f_flush_size bytes and by flush()/the destructor
+    explicit JsonWriter(int f_fd, u64 f_flush_size = CDefaultFlushSize) noexcept
+        : m_flush_size(f_flush_size)
+        , m_fd(f_fd) { }
+
+    ~JsonWriter() noexcept {
+        if (-1 != m_fd) {
+            try {
+                flush();
+            } catch (...) {
+                // Already reported
+            }
+        }
+    }
+
+    JsonWriter(const JsonWriter&)                = delete;
+    JsonWriter& operator=(const JsonWriter&)     = delete;
+    JsonWriter(JsonWriter&&) noexcept            = delete;
+    JsonWriter& operator=(JsonWriter&&) noexcept = delete;
+
+    JsonWriter& begin_object() {
+        separator();
+        m_buffer.push_back('{');
+        m_needs_comma = false;
+        return *this;
+    }
+
+    JsonWriter& end_object() {
+        m_buffer.push_back('}');
+        return end_value();
+    }
+
+    JsonWriter& begin_array() {
+        separator();
+        m_buffer.push_back('[');
+        m_needs_comma = false;
+        return *this;
+    }
+
+    JsonWriter& end_array() {
+        m_buffer.push_back(']');
+        return end_value();
+    }
+
+    //! Member name, followed by its value
+    JsonWriter& key(std::string_view f_key) {
+        separator();
+        write_string(f_key);
+        m_buffer.push_back(':');
+        m_needs_comma = false;
+        return *this;
+    }
+
+    JsonWriter& null() {
+        separator();
+        m_buffer.append("null");
+        return end_value();
+    }
+
+    JsonWriter& value(bool f_value) {
+        separator();
+        m_buffer.append(f_value ? std::string_view{"true"} : std::string_view{"false"});
+        return end_value();
+    }
+
+    template <CIntegerValueFieldType _Type>
+    JsonWriter& value(_Type f_value) {
+        separator();
+
+        char       digits[24];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), f_value);
+        m_buffer.append(digits, result.ptr);
+        return end_value();
+    }
+
+    //! Shortest round trip representation, null if not finite (json has no inf/nan)
+    template <typename _Type>
+        requires(__is_same(_Type, float) || __is_same(_Type, double))
+    JsonWriter& value(_Type f_value) {
+        if (false == std::isfinite(f_value)) {
+            return null();
+        }
+
+        separator();
+
+        char       digits[32];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), f_value);
+        m_buffer.append(digits, result.ptr);
+        return end_value();
+    }
+
+    JsonWriter& value(std::string_view f_value) {
+        separator();
+        write_string(f_value);
+        return end_value();
+    }
+
+    //! Not a bool (the pointer would otherwise convert to one)
+    JsonWriter& value(const char* f_value) {
+        return value(std::string_view{f_value});
+    }
+
+    //! Already formatted json
+    JsonWriter& raw(std::string_view f_json) {
+        separator();
+        m_buffer.append(f_json);
+        return end_value();
+    }
+
+    //! Buffered (not yet flushed) output
+    [[nodiscard]] std::string_view view() const noexcept {
+        return m_buffer;
+    }
+
+    //! Take the buffered output, the writer can then be reused
+    [[nodiscard]] std::string take() noexcept {
+        std::string result{std::move(m_buffer)};
+        m_buffer.clear();
+        m_needs_comma = false;
+        return result;
+    }
+
+    //! Total bytes written (flushed and buffered)
+    [[nodiscard]] u64 size() const noexcept {
+        return m_flushed + m_buffer.size();
+    }
+
+    void reserve(u64 f_bytes) {
+        m_buffer.reserve(f_bytes);
+    }
+
+    //! Write the buffered output to the file descriptor (no-op for buffer writers), throws on failure
+    void flush() {
+        if (-1 == m_fd) {
+            return;
+        }
+
+        u64 offset = 0ULL;
+        while (offset < m_buffer.size()) {
+            const auto written = ::write(m_fd, m_buffer.data() + offset, m_buffer.size() - offset);
+            if (written <= 0) {
+                m_buffer.erase(0U, offset);
+                SERROR_LOCAL_T("JsonWriter failed to write to fd {}!", m_fd);
+                throw std::runtime_error("JsonWriter write failed");
+            }
+
+            offset += static_cast<u64>(written);
+        }
+
+        m_flushed += m_buffer.size();
+        m_buffer.clear();
+    }
+
+private:
+    void separator() {
+        if (m_needs_comma) {
+            m_buffer.push_back(',');
+        }
+    }
+
+    JsonWriter& end_value() {
+        m_needs_comma = true;
+        if ((-1 != m_fd) && (m_buffer.size() >= m_flush_size)) {
+            flush();
+        }
+
+        return *this;
+    }
+
+    //! Quoted and escaped, the runs without characters to escape are copied as a whole
+    void write_string(std::string_view f_value) {
+        m_buffer.push_back('"');
+
+        const char* text  = f_value.data();
+        const auto  count = static_cast<u64>(f_value.size());
+        u64         begin = 0ULL;
+        while (begin < count) {
+            const auto found = simd::find_json_escape(text, begin, count);
+            m_buffer.append(text + begin, found - begin);
+            if (found == count) {
+                break;
+            }
+
+            write_escaped(text[found]);
+            begin = found + 1ULL;
+        }
+
+        m_buffer.push_back('"');
+    }
+
+    void write_escaped(char f_char) {
+        switch (f_char) {
+            case '"':
+                m_buffer.append("\\\"");
+                break;
+            case '\\':
+                m_buffer.append("\\\\");
+                break;
+            case '\b':
+                m_buffer.append("\\b");
+                break;
+            case '\f':
+                m_buffer.append("\\f");
+                break;
+            case '\n':
+                m_buffer.append("\\n");
+                break;
+            case '\r':
+                m_buffer.append("\\r");
+                break;
+            case '\t':
+                m_buffer.append("\\t");
+                break;
+            default: {
+                constexpr char CHex[] = "0123456789abcdef";
+                const auto     value  = static_cast<u8>(f_char);
+                const char     escaped[6]{'\\', 'u', '0', '0', CHex[value >> 4U], CHex[value & 0x0FU]};
+                m_buffer.append(escaped, sizeof(escaped));
+                break;
+            }
+        }
+    }
+
+private:
+    std::string m_buffer;
+    u64         m_flushed{0ULL};
+    u64         m_flush_size{CDefaultFlushSize};
+    int         m_fd{-1};
+    bool        m_needs_comma{false};
+};
+} // namespace skl::config
+
+#undef SKL_LOG_TAG
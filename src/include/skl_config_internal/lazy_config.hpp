@@ -0,0 +1,138 @@
+//!
+//! \file lazy_config
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "skl_config_internal/common.hpp"
+#include "skl_config_internal/diagnostics.hpp"
+#include "skl_config_internal/executor.hpp"
+
+namespace skl::config {
+//! Shared state of a LazyConfig, resolved exactly once
+template <typename _Value>
+struct lazy_config_state_t {
+    using resolver_t = std::function<void(std::string_view, _Value&)>;
+
+    std::string              m_source;             //!< Raw json of the subtree (empty if the default value is used)
+    u64                      m_fingerprint{0ULL};  //!< Hash of the raw json
+    resolver_t               m_resolve;            //!< Decode + validate + submit, throws on failure
+    std::once_flag           m_once;
+    std::atomic<bool>        m_is_resolved{false};
+    _Value                   m_value{};
+    std::exception_ptr       m_error{};
+    std::vector<std::string> m_errors{};
+
+    void resolve() {
+        std::call_once(m_once, [this]() noexcept {
+            DiagnosticsScope scope{m_errors};
+            try {
+                m_resolve(m_source, m_value);
+            } catch (const std::exception& f_ex) {
+                m_error = std::current_exception();
+                m_errors.emplace_back(f_ex.what());
+            } catch (...) {
+                m_error = std::current_exception();
+                m_errors.emplace_back("Unknown error!");
+            }
+
+            // Release the loader, it is not needed anymore
+            m_resolve = nullptr;
+            m_is_resolved.store(true, std::memory_order_release);
+        });
+    }
+};
+} // namespace skl::config
+
+namespace skl {
+//! Config subtree decoded and validated on first access, submitted by the lazy_object()/lazy_array() fields
+//! \remark Copies share the same state, the subtree is resolved exactly once (thread safe)
+template <typename _Value>
+class LazyConfig {
+public:
+    using state_t = config::lazy_config_state_t<_Value>;
+
+    LazyConfig() noexcept = default;
+
+    explicit LazyConfig(std::shared_ptr<state_t> f_state) noexcept
+        : m_state(std::move(f_state)) { }
+
+    //! Decode and validate the subtree (first call only) and return the value
+    //! \remark Throws the same error on every call if the subtree is invalid
+    [[nodiscard]] const _Value& get() const {
+        if (nullptr == m_state) {
+            throw std::runtime_error("LazyConfig has no value!");
+        }
+
+        m_state->resolve();
+        if (nullptr != m_state->m_error) {
+            std::rethrow_exception(m_state->m_error);
+        }
+
+        return m_state->m_value;
+    }
+
+    [[nodiscard]] const _Value& operator*() const {
+        return get();
+    }
+
+    [[nodiscard]] const _Value* operator->() const {
+        return &get();
+    }
+
+    //! Was a value submitted (by a successful load)
+    [[nodiscard]] bool has_value() const noexcept {
+        return nullptr != m_state;
+    }
+
+    [[nodiscard]] bool is_resolved() const noexcept {
+        return (nullptr != m_state) && m_state->m_is_resolved.load(std::memory_order_acquire);
+    }
+
+    //! Errors reported while resolving (resolves first), empty if the subtree is valid
+    [[nodiscard]] const std::vector<std::string>& errors() const {
+        static const std::vector<std::string> CNoErrors{};
+        if (nullptr == m_state) {
+            return CNoErrors;
+        }
+
+        m_state->resolve();
+        return m_state->m_errors;
+    }
+
+    //! Hash of the raw json of the subtree, 0 if the default value is used
+    [[nodiscard]] u64 fingerprint() const noexcept {
+        return (nullptr == m_state) ? 0ULL : m_state->m_fingerprint;
+    }
+
+    //! Raw json of the subtree, empty if the default value is used
+    [[nodiscard]] std::string_view source() const noexcept {
+        return (nullptr == m_state) ? std::string_view{} : std::string_view{m_state->m_source};
+    }
+
+    //! Start resolving on the executor, get() waits for it if still running
+    //! \remark The executor finishes the resolve before it is destroyed (default_executor() at static destruction),
+    //!         no thread is created per lazy value
+    void resolve_in_background(config::Executor& f_executor = config::default_executor()) const {
+        if (nullptr == m_state) {
+            return;
+        }
+
+        f_executor.post([state = m_state]() noexcept { state->resolve(); });
+    }
+
+private:
+    std::shared_ptr<state_t> m_state;
+};
+} // namespace skl
@@ -0,0 +1,383 @@
+//!
+//! \file lazy_field
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <skl_log>
+
+#include "skl_config_internal/field.hpp"
+#include "skl_config_internal/lazy_config.hpp"
+
+#define SKL_LOG_TAG ""
+
+namespace skl::config {
+//! Common part of the lazy fields, only the raw json of the subtree is kept at load time
+//! \remark Submits a LazyConfig that decodes and validates the subtree with a copy of the child node on first access
+template <typename _Derived, typename _Value, CConfigTargetType _TargetConfig>
+class LazyField : public ConfigField<_TargetConfig> {
+public:
+    using member_ptr_t = LazyConfig<_Value> _TargetConfig::*;
+    using resolver_t   = typename lazy_config_state_t<_Value>::resolver_t;
+
+    LazyField(Field* f_parent, std::string_view f_field_name, member_ptr_t f_member_ptr) noexcept
+        : ConfigField<_TargetConfig>(f_parent, f_field_name)
+        , m_member_ptr(f_member_ptr) { }
+
+    ~LazyField() override                      = default;
+    LazyField(const LazyField&)                = default;
+    LazyField& operator=(const LazyField&)     = default;
+    LazyField(LazyField&&) noexcept            = default;
+    LazyField& operator=(LazyField&&) noexcept = default;
+
+    _Derived& required(bool f_required) noexcept {
+        m_required = f_required;
+        return static_cast<_Derived&>(*this);
+    }
+
+    //! Resolve the submitted LazyConfig right away on the node's executor (default_executor() if none), errors are then found early without delaying the load
+    _Derived& validate_in_background(bool f_validate_in_background) noexcept {
+        m_validate_in_background = f_validate_in_background;
+        return static_cast<_Derived&>(*this);
+    }
+
+    void reset() override {
+        m_source.clear();
+        m_loaded.reset();
+        m_has_source         = false;
+        m_is_validation_only = false;
+    }
+
+protected:
+    //! Keep the raw json of the subtree
+    void load(const json& f_json) override {
+        m_loaded.reset();
+        m_source.clear();
+        m_has_source         = false;
+        m_is_validation_only = false;
+
+        const auto it = f_json.find(this->name());
+        if (f_json.end() != it) {
+            if (false == is_expected_type(*it)) {
+                SERROR_LOCAL_T("Field \"{}\" must be {}!\n\tjson: {}", this->path_name().c_str(), expected_type_name(), it->dump().c_str());
+                throw std::runtime_error("Wrong field type!");
+            }
+
+            m_source     = it->dump();
+            m_has_source = true;
+            return;
+        }
+
+        if (m_required) {
+            SERROR_LOCAL_T("Lazy field \"{}\" is required!", this->path_name().c_str());
+            throw std::runtime_error("Missing required lazy field!");
+        }
+
+        if (false == static_cast<const _Derived&>(*this).has_default()) {
+            SERROR_LOCAL_T("Non required lazy field \"{}\" has no default value!", this->path_name().c_str());
+            throw std::runtime_error("Missing default value for required lazy field!");
+        }
+    }
+
+    [[nodiscard]] bool loads_source() const noexcept override {
+        return true;
+    }
+
+    //! Keep the raw json straight from the source, the subtree is not even parsed
+    void load_source(std::string_view f_source, json_span_t f_value) override {
+        const char first = f_source[f_value.m_begin];
+        if (first != (_Derived::CIsArray ? '[' : '{')) {
+            // Load it as usual to report it
+            json holder          = json::object();
+            holder[this->name()] = parse_json_slice(f_source, f_value);
+            load(holder);
+            return;
+        }
+
+        m_loaded.reset();
+        m_source.assign(f_source.substr(f_value.m_begin, f_value.m_end - f_value.m_begin));
+        m_has_source         = true;
+        m_is_validation_only = false;
+    }
+
+    //! The subtree is validated on first access (or in the background), except in validation only mode
+    void validate() override {
+        if (m_is_validation_only && m_loaded.has_value()) {
+            const auto& errors = m_loaded->errors();
+            if (false == errors.empty()) {
+                SERROR_LOCAL_T("Lazy field \"{}\" is invalid! {}", this->path_name().c_str(), errors.back().c_str());
+                throw std::runtime_error("Lazy field validation failed!");
+            }
+        }
+    }
+
+    void submit(_TargetConfig& f_config) override {
+        if (m_loaded.has_value()) {
+            f_config.*m_member_ptr = m_loaded.value();
+            return;
+        }
+
+        auto state           = std::make_shared<lazy_config_state_t<_Value>>();
+        state->m_source      = m_source;
+        state->m_fingerprint = m_has_source ? hash_bytes(m_source.data(), m_source.size()) : 0ULL;
+        state->m_resolve     = static_cast<const _Derived&>(*this).make_resolver(m_has_source);
+
+        LazyConfig<_Value> lazy{std::move(state)};
+        if (m_validate_in_background) {
+            auto* executor = this->executor();
+            lazy.resolve_in_background((nullptr != executor) ? *executor : default_executor());
+        }
+
+        f_config.*m_member_ptr = std::move(lazy);
+    }
+
+    void load_value_from_default_object(const _TargetConfig& f_config) override {
+        m_loaded             = f_config.*m_member_ptr;
+        m_has_source         = false;
+        m_is_validation_only = false;
+    }
+
+    void load_value_for_validation_only(const _TargetConfig& f_config) override {
+        m_loaded             = f_config.*m_member_ptr;
+        m_has_source         = false;
+        m_is_validation_only = true;
+    }
+
+    std::unique_ptr<ConfigField<_TargetConfig>> clone() override {
+        return std::make_unique<_Derived>(static_cast<const _Derived&>(*this));
+    }
+
+    //! Resolves the value first, null if none was submitted
+    void serialize(const _TargetConfig& f_config, JsonWriter& f_writer) const override {
+        const auto& lazy = f_config.*m_member_ptr;
+
+        f_writer.key(this->name());
+        if (false == lazy.has_value()) {
+            (void)f_writer.null();
+            return;
+        }
+
+        static_cast<const _Derived&>(*this).serialize_value(lazy.get(), f_writer);
+    }
+
+    void hash_schema(SchemaHasher& f_hasher) const override {
+        f_hasher.add_type<_Derived>();
+        f_hasher.add_string(this->name());
+        f_hasher.add(m_required);
+        f_hasher.add(m_validate_in_background);
+        static_cast<const _Derived&>(*this).hash_child_schema(f_hasher);
+    }
+
+    void save_state(SnapshotWriter& f_writer) const override {
+        if (m_loaded.has_value()) {
+            f_writer.write<bool>(false == m_loaded->source().empty());
+            f_writer.write_string(m_loaded->source());
+            return;
+        }
+
+        f_writer.write<bool>(m_has_source);
+        f_writer.write_string(m_source);
+    }
+
+    void load_state(SnapshotReader& f_reader) override {
+        m_loaded.reset();
+        m_has_source         = f_reader.read<bool>();
+        m_source             = f_reader.read_string();
+        m_is_validation_only = false;
+    }
+
+private:
+    [[nodiscard]] bool is_expected_type(const json& f_json) const noexcept {
+        return _Derived::CIsArray ? f_json.is_array() : f_json.is_object();
+    }
+
+    [[nodiscard]] static const char* expected_type_name() noexcept {
+        return _Derived::CIsArray ? "an array" : "an object";
+    }
+
+protected:
+    member_ptr_t                      m_member_ptr;
+    std::string                       m_source;
+    std::optional<LazyConfig<_Value>> m_loaded; //!< Taken from the default/validated object instead of the json
+    bool                              m_required{false};
+    bool                              m_validate_in_background{false};
+    bool                              m_has_source{false};
+    bool                              m_is_validation_only{false};
+};
+
+//! Object field decoded on first access, see LazyField
+template <CConfigTargetType _Object, CConfigTargetType _TargetConfig>
+class LazyObjectField : public LazyField<LazyObjectField<_Object, _TargetConfig>, _Object, _TargetConfig> {
+    using base_t = LazyField<LazyObjectField<_Object, _TargetConfig>, _Object, _TargetConfig>;
+
+public:
+    static constexpr bool CIsArray = false;
+
+    LazyObjectField(Field* f_parent, std::string_view f_field_name, typename base_t::member_ptr_t f_member_ptr, ConfigNode<_Object>&& f_config) noexcept
+        : base_t(f_parent, f_field_name, f_member_ptr)
+        , m_config(std::move(f_config)) { }
+
+    LazyObjectField& default_value(const _Object& f_default) {
+        m_default = f_default;
+        return *this;
+    }
+
+    LazyObjectField& default_value(_Object&& f_default) {
+        m_default = std::move(f_default);
+        return *this;
+    }
+
+private:
+    [[nodiscard]] bool has_default() const noexcept {
+        return m_default.has_value();
+    }
+
+    //! Decode from the raw json, or from the default value
+    [[nodiscard]] typename base_t::resolver_t make_resolver(bool f_has_source) const {
+        ConfigNode<_Object> node = m_config;
+        node.detach(m_config.path_name());
+
+        if (f_has_source) {
+            return [node = std::move(node)](std::string_view f_source, _Object& f_out) mutable {
+                json j = json::parse(f_source,
+                    /* callback */ nullptr,
+                    /* allow_exceptions */ true,
+                    /* ignore_comments */ true);
+
+                node.load(j);
+                node.validate();
+                node.submit(f_out);
+            };
+        }
+
+        SKL_ASSERT(m_default.has_value());
+        return [node = std::move(node), value = m_default.value()](std::string_view, _Object& f_out) mutable {
+            node.load_fields_from_default_object(value);
+            node.validate();
+            node.submit(f_out);
+        };
+    }
+
+    void serialize_value(const _Object& f_value, JsonWriter& f_writer) const {
+        m_config.serialize(f_value, f_writer);
+    }
+
+    void hash_child_schema(SchemaHasher& f_hasher) const {
+        f_hasher.add(m_default.has_value());
+        m_config.hash_schema(f_hasher);
+    }
+
+    void apply_filter(const path_filter_node_t* f_filter) override {
+        m_config.apply_filter(f_filter);
+    }
+
+    void update_parent(Field& f_new_parent) noexcept override {
+        Field::update_parent(f_new_parent);
+        m_config.update_parent(f_new_parent);
+    }
+
+    friend base_t;
+
+private:
+    ConfigNode<_Object>    m_config;
+    std::optional<_Object> m_default;
+};
+
+template <typename _Container>
+struct lazy_array_holder_t {
+    _Container m_value;
+};
+
+//! Array of objects decoded on first access, see LazyField
+//! \remark Decoded through an ArrayField, the length options are forwarded to it
+template <CConfigTargetType _Object, CConfigTargetType _TargetConfig, CContainerType _Container>
+class LazyArrayField : public LazyField<LazyArrayField<_Object, _TargetConfig, _Container>, _Container, _TargetConfig> {
+    using base_t   = LazyField<LazyArrayField<_Object, _TargetConfig, _Container>, _Container, _TargetConfig>;
+    using holder_t = lazy_array_holder_t<_Container>;
+    using array_t  = ArrayField<_Object, holder_t, _Container>;
+
+public:
+    static constexpr bool CIsArray = true;
+
+    LazyArrayField(Field* f_parent, std::string_view f_field_name, typename base_t::member_ptr_t f_member_ptr, ConfigNode<_Object>&& f_config)
+        : base_t(f_parent, f_field_name, f_member_ptr) {
+        (void)m_holder.template array<_Object, _Container>(skl_string_view::from_std(f_field_name), &holder_t::m_value, std::move(f_config));
+    }
+
+    LazyArrayField& default_value(std::vector<_Object>&& f_default) {
+        array_field().default_value(std::move(f_default));
+        m_has_default = true;
+        return *this;
+    }
+
+    LazyArrayField& min_length(u32 f_min_length) noexcept {
+        array_field().min_length(f_min_length);
+        return *this;
+    }
+
+    LazyArrayField& max_length(u32 f_max_length) noexcept {
+        array_field().max_length(f_max_length);
+        return *this;
+    }
+
+    LazyArrayField& min_max_length(u32 f_min_length, u32 f_max_length) noexcept {
+        array_field().min_max_length(f_min_length, f_max_length);
+        return *this;
+    }
+
+    LazyArrayField& truncate_on_overflow(bool f_truncate_on_overflow) noexcept
+        requires(false == array_t::CIsResizableContainer)
+    {
+        array_field().truncate_on_overflow(f_truncate_on_overflow);
+        return *this;
+    }
+
+private:
+    [[nodiscard]] bool has_default() const noexcept {
+        return m_has_default;
+    }
+
+    //! Decode from the raw json, or from the default value (when the json has no member)
+    [[nodiscard]] typename base_t::resolver_t make_resolver(bool f_has_source) const {
+        ConfigNode<holder_t> node = m_holder;
+        node.detach((nullptr == this->m_parent) ? std::string{} : this->m_parent->path_name());
+
+        return [node = std::move(node), name = std::string{this->name()}, f_has_source](std::string_view f_source, _Container& f_out) mutable {
+            json holder = json::object();
+            if (f_has_source) {
+                holder[name] = json::parse(f_source,
+                    /* callback */ nullptr,
+                    /* allow_exceptions */ true,
+                    /* ignore_comments */ true);
+            }
+
+            holder_t value{};
+            node.load(holder);
+            node.validate();
+            node.submit(value);
+            f_out = std::move(value.m_value);
+        };
+    }
+
+    void serialize_value(const _Container& f_value, JsonWriter& f_writer) const {
+        static_cast<const array_t&>(*m_holder.m_fields.front()).serialize_value(f_value, f_writer);
+    }
+
+    void hash_child_schema(SchemaHasher& f_hasher) const {
+        m_holder.hash_schema(f_hasher);
+    }
+
+    [[nodiscard]] array_t& array_field() noexcept {
+        return static_cast<array_t&>(*m_holder.m_fields.front());
+    }
+
+    friend base_t;
+
+private:
+    ConfigNode<holder_t> m_holder;
+    bool                 m_has_default{false};
+};
+} // namespace skl::config
+
+#undef SKL_LOG_TAG
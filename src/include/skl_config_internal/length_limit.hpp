@@ -0,0 +1,100 @@
+//!
+//! \file length_limit
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <skl_log>
+
+#include <nlohmann/json.hpp>
+
+#include "skl_config_internal/common.hpp"
+
+#define SKL_LOG_TAG ""
+
+namespace skl::config {
+//! Node of the array length limits tree, one per member on the way to a length limited array
+//! \remark Array elements share the array's node (same as path filters)
+struct length_limit_node_t {
+    std::string                      m_name;
+    std::string                      m_path{};                 //!< Path name of the limited array field
+    std::vector<length_limit_node_t> m_children{};
+    u64                              m_max_length{~0ULL};      //!< Max elements count of the array member
+
+    [[nodiscard]] const length_limit_node_t* find(std::string_view f_name) const noexcept {
+        for (const auto& child : m_children) {
+            if (f_name == child.m_name) {
+                return &child;
+            }
+        }
+
+        return nullptr;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return m_children.empty() && (~0ULL == m_max_length);
+    }
+};
+
+//! Parser callback rejecting the arrays longer than their max length (see f_root) while they are parsed
+//! \remark The parse stops at the first element past the limit, the rest of the array is never added to the document
+//! \remark f_root must outlive the parse
+[[nodiscard]] inline nlohmann::json::parser_callback_t make_length_limit_callback(const length_limit_node_t& f_root) {
+    struct frame_t {
+        const length_limit_node_t* m_node;   //!< nullptr = nothing limited in this subtree
+        const length_limit_node_t* m_member; //!< Node of the current member (objects)
+        u64                        m_count;  //!< Elements seen so far (arrays)
+        bool                       m_is_array;
+    };
+
+    // Count the element starting in the innermost container, returns the node of the new value
+    const auto begin_value = [](std::vector<frame_t>& f_frames) -> const length_limit_node_t* {
+        auto& top = f_frames.back();
+        if (false == top.m_is_array) {
+            return top.m_member;
+        }
+
+        if ((nullptr != top.m_node) && (++top.m_count > top.m_node->m_max_length)) {
+            SERROR_LOCAL_T("Array field \"{}\" elements count exceeds max={}!", top.m_node->m_path.c_str(), top.m_node->m_max_length);
+            throw std::runtime_error("Array field has invalid length!");
+        }
+
+        return top.m_node;
+    };
+
+    return [&f_root, begin_value, frames = std::vector<frame_t>{}](int, nlohmann::json::parse_event_t f_event, nlohmann::json& f_parsed) mutable -> bool {
+        using event_t = nlohmann::json::parse_event_t;
+
+        switch (f_event) {
+            case event_t::object_start:
+            case event_t::array_start: {
+                const auto* node = frames.empty() ? &f_root : begin_value(frames);
+                frames.push_back(frame_t{node, nullptr, 0ULL, event_t::array_start == f_event});
+                break;
+            }
+            case event_t::key:
+                frames.back().m_member = (nullptr == frames.back().m_node) ? nullptr : frames.back().m_node->find(f_parsed.get_ref<const std::string&>());
+                break;
+            case event_t::value:
+                if (false == frames.empty()) {
+                    (void)begin_value(frames);
+                }
+                break;
+            case event_t::object_end:
+            case event_t::array_end:
+                frames.pop_back();
+                break;
+        }
+
+        return true;
+    };
+}
+} // namespace skl::config
+
+#undef SKL_LOG_TAG
@@ -0,0 +1,208 @@
+//!
+//! \file load_session
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <istream>
+#include <mutex>
+#include <span>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+//! \remark Included at the end of skl_config, after ConfigNode is complete
+namespace skl::config {
+//! Stream buffer over chunks pushed by another thread, underflow() blocks until data or the end is available
+//! \remark push() blocks while more than max queued bytes wait to be parsed (a single larger chunk is still accepted)
+class ChunkStreamBuffer final : public std::streambuf {
+public:
+    explicit ChunkStreamBuffer(u64 f_max_queued_bytes) noexcept
+        : m_max_queued_bytes(f_max_queued_bytes) {}
+
+    //! Queue \p f_chunk for the reader, returns false if the reader abandoned the stream (chunk dropped)
+    [[nodiscard]] bool push(std::span<const char> f_chunk) {
+        if (f_chunk.empty()) {
+            return true;
+        }
+
+        {
+            std::unique_lock lock{m_lock};
+            m_space_ready.wait(lock, [this, &f_chunk]() noexcept {
+                return m_abandoned || (0ULL == m_queued_bytes) || ((m_queued_bytes + f_chunk.size()) <= m_max_queued_bytes);
+            });
+            if (m_abandoned) {
+                return false;
+            }
+
+            m_chunks.emplace_back(f_chunk.data(), f_chunk.size());
+            m_queued_bytes += f_chunk.size();
+        }
+        m_data_ready.notify_one();
+
+        return true;
+    }
+
+    //! End of input, the reader sees eof after the queued chunks
+    void close() noexcept {
+        {
+            std::lock_guard guard{m_lock};
+            m_closed = true;
+        }
+        m_data_ready.notify_one();
+    }
+
+    //! The reader stops reading, drops the queued chunks and releases the blocked writer
+    void abandon() noexcept {
+        {
+            std::lock_guard guard{m_lock};
+            m_abandoned    = true;
+            m_queued_bytes = 0ULL;
+            m_chunks.clear();
+        }
+        m_space_ready.notify_all();
+    }
+
+protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+
+        std::unique_lock lock{m_lock};
+        m_data_ready.wait(lock, [this]() noexcept { return m_closed || (false == m_chunks.empty()); });
+        if (m_chunks.empty()) {
+            return traits_type::eof();
+        }
+
+        m_current = std::move(m_chunks.front());
+        m_chunks.pop_front();
+        m_queued_bytes -= m_current.size();
+        lock.unlock();
+        m_space_ready.notify_one();
+
+        setg(m_current.data(), m_current.data(), m_current.data() + m_current.size());
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    std::mutex              m_lock;
+    std::condition_variable m_data_ready;  //!< Reader waits for chunks or close
+    std::condition_variable m_space_ready; //!< Writer waits for the queue to drain under the cap
+    std::deque<std::string> m_chunks;
+    std::string             m_current;
+    u64                     m_queued_bytes{0ULL};
+    const u64               m_max_queued_bytes;
+    bool                    m_closed{false};
+    bool                    m_abandoned{false};
+};
+
+//! Incremental load of a config arriving in chunks (pipe, socket, ...)
+//! \remark Chunks are parsed as they arrive on a parser thread, validate/submit semantics are the same as load_validate_and_submit()
+template <CConfigTargetType _TargetConfig>
+class LoadSession {
+public:
+    //! Default cap of the bytes fed but not yet parsed
+    static constexpr u64 CDefaultMaxQueuedBytes = 16ULL * 1024ULL * 1024ULL;
+
+    explicit LoadSession(ConfigNode<_TargetConfig>& f_loader, u64 f_max_queued_bytes = CDefaultMaxQueuedBytes)
+        : m_loader(f_loader)
+        , m_buffer(f_max_queued_bytes) {
+        m_loader.reset();
+        m_parser = std::thread([this]() noexcept { parse_and_load(); });
+    }
+
+    ~LoadSession() noexcept {
+        abort();
+    }
+
+    LoadSession(const LoadSession&)            = delete;
+    LoadSession& operator=(const LoadSession&) = delete;
+    LoadSession(LoadSession&&)                 = delete;
+    LoadSession& operator=(LoadSession&&)      = delete;
+
+    //! Feed the next chunk of the json document (copied)
+    //! \remark Blocks while the parser is behind by more than the max queued bytes
+    //! \remark Throws the parse/load error as soon as the parser failed, the rest of the input need not be read
+    void feed(std::span<const char> f_chunk) {
+        if (m_finished) {
+            throw std::runtime_error("Config load session already finished!");
+        }
+
+        if (m_parser_done.load(std::memory_order_acquire) || (false == m_buffer.push(f_chunk))) {
+            throw_parser_error();
+        }
+    }
+
+    //! End of input, wait for the parser and validate and submit into \p f_out_config
+    //! \remark Throws on any parse, load or validation error, \p f_out_config is only written if all succeeded
+    void finish(_TargetConfig& f_out_config) {
+        if (m_finished) {
+            throw std::runtime_error("Config load session already finished!");
+        }
+
+        m_finished = true;
+        m_buffer.close();
+        m_parser.join();
+
+        if (nullptr != m_error) {
+            std::rethrow_exception(m_error);
+        }
+
+        m_loader.validate();
+        m_loader.submit(f_out_config);
+    }
+
+private:
+    void parse_and_load() noexcept {
+        try {
+            config::length_limit_node_t limits{};
+            std::istream                stream{&m_buffer};
+            json                        j = json::parse(stream,
+                /* callback */ m_loader.length_limit_callback(limits),
+                /* allow_exceptions */ true,
+                /* ignore_comments */ true);
+
+            // Load while the caller is still around to call finish()
+            m_loader.load(j);
+        } catch (...) {
+            m_error = std::current_exception();
+        }
+
+        // Nothing reads the input anymore, release a feed() blocked on the cap
+        m_parser_done.store(true, std::memory_order_release);
+        m_buffer.abandon();
+    }
+
+    //! The parser stopped before the end of the input (m_parser_done)
+    [[noreturn]] void throw_parser_error() const {
+        if (nullptr != m_error) {
+            std::rethrow_exception(m_error);
+        }
+
+        throw std::runtime_error("Config load session parser stopped before the end of the input!");
+    }
+
+    void abort() noexcept {
+        if (false == m_finished) {
+            m_finished = true;
+            m_buffer.close();
+            m_parser.join();
+            m_loader.reset();
+        }
+    }
+
+private:
+    ConfigNode<_TargetConfig>& m_loader;
+    ChunkStreamBuffer          m_buffer;
+    std::thread                m_parser;
+    std::exception_ptr         m_error;       //!< Written by the parser before m_parser_done
+    std::atomic<bool>          m_parser_done{false};
+    bool                       m_finished{false};
+};
+} // namespace skl::config
@@ -0,0 +1,89 @@
+//!
+//! \file load_task
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace skl::config {
+//! Resumable config load, see ConfigNode::load_stepwise()
+//! \remark Each resume() runs one slice of the load on the calling thread and returns when the slice budget is used
+class LoadTask {
+public:
+    struct promise_type {
+        LoadTask get_return_object() noexcept {
+            return LoadTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept {
+            return {};
+        }
+
+        void return_void() noexcept { }
+
+        void unhandled_exception() noexcept {
+            m_error = std::current_exception();
+        }
+
+        std::exception_ptr m_error;
+    };
+
+    ~LoadTask() noexcept {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+    LoadTask(const LoadTask&)            = delete;
+    LoadTask& operator=(const LoadTask&) = delete;
+
+    LoadTask(LoadTask&& f_other) noexcept
+        : m_handle(std::exchange(f_other.m_handle, nullptr)) { }
+
+    LoadTask& operator=(LoadTask&& f_other) noexcept {
+        if (this != &f_other) {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+            m_handle = std::exchange(f_other.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    //! Has the load completed (successfully or not)
+    [[nodiscard]] bool done() const noexcept {
+        return (false == static_cast<bool>(m_handle)) || m_handle.done();
+    }
+
+    //! Run the next slice
+    //! \returns true if the load completed
+    bool resume() {
+        if (false == done()) {
+            m_handle.resume();
+        }
+        return done();
+    }
+
+    //! Rethrow the load error (if any), the task must be done
+    void get() const {
+        if (m_handle && (nullptr != m_handle.promise().m_error)) {
+            std::rethrow_exception(m_handle.promise().m_error);
+        }
+    }
+
+private:
+    explicit LoadTask(std::coroutine_handle<promise_type> f_handle) noexcept
+        : m_handle(f_handle) { }
+
+private:
+    std::coroutine_handle<promise_type> m_handle;
+};
+} // namespace skl::config
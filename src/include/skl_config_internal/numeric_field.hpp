@@ -5,11 +5,16 @@
 //!
 #pragma once
 
+#include <algorithm>
 #include <charconv>
+#include <cmath>
+#include <limits>
+#include <utility>
 
 #include <skl_log>
 
 #include "skl_config_internal/field.hpp"
+#include "skl_config_internal/simd.hpp"
 
 #define SKL_LOG_TAG ""
 
@@ -19,7 +24,8 @@ class NumericField;
 
 template <typename _Type, typename _Functor>
 concept CNumericFieldParseRawFunctor = __is_class(_Functor)
-                                    && std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, const std::string&>;
+                                    && (std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, std::string_view>
+                                        || std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, const std::string&>);
 
 template <typename _Type, typename _Functor>
 concept CNumericFieldConstraintFunctor = __is_class(_Functor)
@@ -27,7 +33,7 @@ concept CNumericFieldConstraintFunctor = __is_class(_Functor)
 
 template <typename _Type, typename _Functor>
 concept CNumericFieldParseJsonFunctor = __is_class(_Functor)
-                                     && std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, json&>;
+                                     && std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, const json&>;
 
 template <typename _Type, typename _Functor>
 concept CNumericFieldPostLoadFunctor = __is_class(_Functor)
@@ -37,13 +43,65 @@ template <typename _Type, typename _Functor, typename _TargetConfig>
 concept CNumericFieldPreSubmitFunctor = __is_class(_Functor)
                                      && std::is_invocable_r_v<bool, _Functor, Field&, _Type, _TargetConfig&>;
 
+//! Parse the (prefix of the) text as a value of _Type, nullopt if not a number or out of range
+template <CNumericValueFieldType _Type>
+[[nodiscard]] std::optional<_Type> convert_to_numeric(std::string_view f_str) {
+    _Type value;
+    auto [ptr, ec] = std::from_chars(f_str.data(), f_str.data() + f_str.size(), value);
+    if (ec != std::errc{}) {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+//! Decode a json number (or numeric string) as NumericField::load() would, without going through a field
+template <CNumericValueFieldType _Type>
+[[nodiscard]] std::optional<_Type> decode_numeric(const json& f_json) {
+    switch (f_json.type()) {
+        case json::value_t::number_integer: {
+            const auto value = f_json.template get_ref<const json::number_integer_t&>();
+            if constexpr (CIntegerValueFieldType<_Type>) {
+                return std::in_range<_Type>(value) ? std::optional<_Type>{static_cast<_Type>(value)} : std::nullopt;
+            } else {
+                return static_cast<_Type>(value);
+            }
+        }
+        case json::value_t::number_unsigned: {
+            const auto value = f_json.template get_ref<const json::number_unsigned_t&>();
+            if constexpr (CIntegerValueFieldType<_Type>) {
+                return std::in_range<_Type>(value) ? std::optional<_Type>{static_cast<_Type>(value)} : std::nullopt;
+            } else {
+                return static_cast<_Type>(value);
+            }
+        }
+        case json::value_t::number_float: {
+            if constexpr (false == CIntegerValueFieldType<_Type>) {
+                const auto value = f_json.template get_ref<const json::number_float_t&>();
+                if (std::abs(value) > static_cast<double>(std::numeric_limits<_Type>::max())) {
+                    return std::nullopt;
+                }
+
+                return static_cast<_Type>(value);
+            }
+
+            // Integer from a float, same (prefix) parse as load()
+            break;
+        }
+        default:
+            break;
+    }
+
+    return convert_to_numeric<_Type>(JsonScalarText{f_json}.view());
+}
+
 template <CNumericValueFieldType _Type, CConfigTargetType _TargetConfig>
 class NumericField : public ConfigField<_TargetConfig> {
 public:
     using member_ptr_t   = _Type _TargetConfig::*;
     using constraints_t  = std::vector<std::function<bool(Field&, _Type)>>;
-    using raw_parsert_t  = std::function<std::optional<_Type>(Field&, const std::string&)>;
-    using json_parsert_t = std::function<std::optional<_Type>(Field&, json&)>;
+    using raw_parsert_t  = std::function<std::optional<_Type>(Field&, std::string_view)>;
+    using json_parsert_t = std::function<std::optional<_Type>(Field&, const json&)>;
     using post_load_t    = std::function<bool(Field&, _Type)>;
     using pre_submit_t   = std::function<bool(Field&, _Type, _TargetConfig&)>;
 
@@ -75,39 +133,29 @@ public:
         return *this;
     }
 
-    NumericField& min(_Type f_min) {
-        add_constraint([f_min](Field& f_self, _Type f_value) {
-            if (f_value < f_min) {
-                SERROR("Invalid numeric field \"{}\" value! Min[{}]!", f_self.path_name().c_str(), f_min);
-                return false;
-            }
-            return true;
-        });
+    //! \remark Built-in constraint, checked over whole arrays by the vectorized kernels (see simd.hpp)
+    NumericField& min(_Type f_min) noexcept {
+        m_min = m_min.has_value() ? std::max(m_min.value(), f_min) : f_min;
         return *this;
     }
 
-    NumericField& max(_Type f_max) {
-        add_constraint([f_max](Field& f_self, _Type f_value) {
-            if (f_value > f_max) {
-                SERROR("Invalid numeric field \"{}\" value! Max[{}]!", f_self.path_name().c_str(), f_max);
-                return false;
-            }
-
-            return true;
-        });
+    //! \remark Built-in constraint, checked over whole arrays by the vectorized kernels (see simd.hpp)
+    NumericField& max(_Type f_max) noexcept {
+        m_max = m_max.has_value() ? std::min(m_max.value(), f_max) : f_max;
         return *this;
     }
 
-    NumericField& power_of_2()
+    //! Value must be in [f_min, f_max]
+    NumericField& range(_Type f_min, _Type f_max) noexcept {
+        return min(f_min).max(f_max);
+    }
+
+    //! Value must be a power of 2 (min 2)
+    //! \remark Built-in constraint, checked over whole arrays by the vectorized kernels (see simd.hpp)
+    NumericField& power_of_2() noexcept
         requires(CIntegerValueFieldType<_Type>)
     {
-        add_constraint<decltype([](Field& f_self, _Type f_value) static {
-            if ((f_value < 2U) || (_Type(0) != ((f_value - _Type(1)) & f_value))) {
-                SERROR("Invalid numeric field \"{}\" value({}) must be a power of 2! Min[2]!", f_self.path_name().c_str(), f_value);
-                return false;
-            }
-            return true;
-        })>();
+        m_power_of_2 = true;
         return *this;
     }
 
@@ -116,7 +164,14 @@ public:
     template <typename _Functor>
         requires(CNumericFieldParseRawFunctor<_Type, _Functor>)
     NumericField& parse_raw(_Functor&& f_functor) {
-        m_custom_raw_parser = std::forward<_Functor>(f_functor);
+        if constexpr (std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, std::string_view>) {
+            m_custom_raw_parser = std::forward<_Functor>(f_functor);
+        } else {
+            // Takes a std::string, copy the raw value for it
+            m_custom_raw_parser = [functor = std::forward<_Functor>(f_functor)](Field& f_self, std::string_view f_string) mutable {
+                return functor(f_self, std::string{f_string});
+            };
+        }
         return *this;
     }
 
@@ -125,12 +180,18 @@ public:
     template <typename _Functor>
         requires(CNumericFieldParseRawFunctor<_Type, _Functor>)
     NumericField& parse_raw() {
-        m_custom_raw_parser = raw_parsert_t(&_Functor::operator());
+        if constexpr (std::is_invocable_r_v<std::optional<_Type>, _Functor, Field&, std::string_view>) {
+            m_custom_raw_parser = raw_parsert_t(&_Functor::operator());
+        } else {
+            m_custom_raw_parser = [](Field& f_self, std::string_view f_string) {
+                return _Functor::operator()(f_self, std::string{f_string});
+            };
+        }
         return *this;
     }
 
     //! Set custom json node parser
-    //! \remark (Field& f_self, json& f_json) -> std::optional<_Type>
+    //! \remark (Field& f_self, const json& f_json) -> std::optional<_Type>
     template <typename _Functor>
         requires(CNumericFieldParseJsonFunctor<_Type, _Functor>)
     NumericField& parse_json(_Functor&& f_functor) {
@@ -139,7 +200,7 @@ public:
     }
 
     //! Set custom json node parser
-    //! \remark (Field& f_self, json& f_json) static -> std::optional<_Type>
+    //! \remark (Field& f_self, const json& f_json) static -> std::optional<_Type>
     template <typename _Functor>
         requires(CNumericFieldParseJsonFunctor<_Type, _Functor>)
     NumericField& parse_json() {
@@ -218,40 +279,37 @@ public:
     [[nodiscard]] static std::optional<_Type> safely_convert_to_numeric(std::string_view f_str)
         requires(CNumericValueFieldType<_Type>)
     {
-        _Type value;
-        auto [ptr, ec] = std::from_chars(f_str.data(), f_str.data() + f_str.size(), value);
-        if (ec != std::errc{}) {
-            return std::nullopt;
-        }
-
-        return value;
+        return convert_to_numeric<_Type>(f_str);
     }
 
 protected:
-    void load(json& f_json) override {
-        bool  exists   = false;
-        json* src_json = nullptr;
+    void load(const json& f_json) override {
+        bool        exists   = false;
+        const json* src_json = nullptr;
 
         if (f_json.is_number() || f_json.is_string()) {
             exists   = true;
             src_json = &f_json;
         } else {
-            exists   = f_json.contains(this->name());
-            src_json = &f_json[this->name()];
+            // Lookup only, the json is shared with other fields (possibly loading in parallel)
+            const auto it = f_json.find(this->name());
+            exists        = f_json.end() != it;
+            src_json      = exists ? &(*it) : nullptr;
         }
 
         if (exists) {
             if (false == m_custom_json_parser.has_value()) {
+                // Decoded from a view of the raw value, no copy
+                const JsonScalarText text{*src_json};
                 if (m_custom_raw_parser.has_value()) {
-                    const auto temp   = src_json->is_string() ? src_json->template get<std::string>() : src_json->dump();
-                    const auto result = m_custom_raw_parser.value()(*this, temp);
+                    const auto result = m_custom_raw_parser.value()(*this, text.view());
                     if (false == result.has_value()) {
                         throw std::runtime_error("Custom parsing for numeric field failed!");
                     }
 
                     m_value = result;
                 } else {
-                    const auto result = safely_convert_to_numeric(src_json->is_string() ? src_json->template get<std::string>() : src_json->dump());
+                    const auto result = safely_convert_to_numeric(text.view());
                     if (false == result.has_value()) {
                         SERROR_LOCAL_T("Numeric field \"{}\" has an invalid {} value({})! Min[{}] Max[{}]",
                                        this->path_name().c_str(),
@@ -307,15 +365,18 @@ protected:
 
         if ((false == m_is_default) || m_validate_if_default || false == m_is_validation_only) {
             //Run constraints
-            for (const auto& constraint : m_constraints) {
-                if (false == constraint(*this, m_value.value())) {
-                    if (m_is_default) {
-                        SERROR_LOCAL_T("Invalid default value({}) for numeric field\"{}\"!", m_value.value(), this->path_name().c_str());
-                        throw std::runtime_error("NumericField<T> Invalid default value");
-                    } else {
-                        SERROR_LOCAL_T("Invalid value({}) for numeric field\"{}\"!", m_value.value(), this->path_name().c_str());
-                        throw std::runtime_error("NumericField<T> Invalid value");
-                    }
+            bool passed = check_builtin_constraints(m_value.value());
+            for (u64 i = 0ULL; passed && (i < m_constraints.size()); ++i) {
+                passed = m_constraints[i](*this, m_value.value());
+            }
+
+            if (false == passed) {
+                if (m_is_default) {
+                    SERROR_LOCAL_T("Invalid default value({}) for numeric field\"{}\"!", m_value.value(), this->path_name().c_str());
+                    throw std::runtime_error("NumericField<T> Invalid default value");
+                } else {
+                    SERROR_LOCAL_T("Invalid value({}) for numeric field\"{}\"!", m_value.value(), this->path_name().c_str());
+                    throw std::runtime_error("NumericField<T> Invalid value");
                 }
             }
         }
@@ -350,9 +411,153 @@ protected:
         return std::make_unique<NumericField<_Type, _TargetConfig>>(*this);
     }
 
+    void serialize(const _TargetConfig& f_config, JsonWriter& f_writer) const override {
+        f_writer.key(this->name());
+        serialize_value(f_config.*m_member_ptr, f_writer);
+    }
+
+    //! Write a value of this field as json
+    static void serialize_value(_Type f_value, JsonWriter& f_writer) {
+        (void)f_writer.value(f_value);
+    }
+
+    void hash_schema(SchemaHasher& f_hasher) const override {
+        f_hasher.add_type<NumericField<_Type, _TargetConfig>>();
+        f_hasher.add_string(this->name());
+        f_hasher.add_optional(m_default);
+        f_hasher.add(m_required);
+        f_hasher.add(m_validate_if_default);
+        f_hasher.add_optional(m_min);
+        f_hasher.add_optional(m_max);
+        f_hasher.add(m_power_of_2);
+        f_hasher.add(m_constraints.size());
+        f_hasher.add(m_custom_raw_parser.has_value());
+        f_hasher.add(m_custom_json_parser.has_value());
+        f_hasher.add(m_post_load.has_value());
+        f_hasher.add(m_pre_submit.has_value());
+    }
+
+    void save_state(SnapshotWriter& f_writer) const override {
+        f_writer.write_optional(m_value);
+        f_writer.write(m_is_default);
+    }
+
+    void load_state(SnapshotReader& f_reader) override {
+        m_value              = f_reader.read_optional<_Type>();
+        m_is_default         = f_reader.read<bool>();
+        m_is_validation_only = false;
+    }
+
+private:
+    //! Decode a json number (or numeric string) as load() would, without going through the field state
+    [[nodiscard]] static std::optional<_Type> decode_value(const json& f_json) {
+        return decode_numeric<_Type>(f_json);
+    }
+
+    //! Can the elements of an array of this field be decoded and checked in bulk (no custom parser or handlers)
+    [[nodiscard]] bool is_bulk_decodable() const noexcept {
+        return (false == m_custom_raw_parser.has_value())
+            && (false == m_custom_json_parser.has_value())
+            && (false == m_post_load.has_value())
+            && (false == m_pre_submit.has_value());
+    }
+
+    //! Decode the elements [f_begin, f_end) of f_array into f_out[0, f_end - f_begin)
+    void bulk_decode(const json& f_array, u64 f_begin, u64 f_end, _Type* f_out) const {
+        for (u64 i = f_begin; i < f_end; ++i) {
+            const auto& element = f_array[i];
+            const auto  value   = decode_value(element);
+            if (false == value.has_value()) {
+                SERROR_LOCAL_T("Numeric array \"{}\" has an invalid value({}) at [{}]! Min[{}] Max[{}]",
+                               this->path_name().c_str(),
+                               element.dump().c_str(),
+                               i,
+                               std::numeric_limits<_Type>::min(),
+                               std::numeric_limits<_Type>::max());
+                throw std::runtime_error("Invalid numeric field value!");
+            }
+
+            f_out[i - f_begin] = value.value();
+        }
+    }
+
+    //! Check the min, max and power of 2 constraints
+    [[nodiscard]] bool check_builtin_constraints(_Type f_value) const noexcept {
+        if (m_min.has_value() && (f_value < m_min.value())) {
+            SERROR("Invalid numeric field \"{}\" value! Min[{}]!", this->path_name().c_str(), m_min.value());
+            return false;
+        }
+
+        if (m_max.has_value() && (f_value > m_max.value())) {
+            SERROR("Invalid numeric field \"{}\" value! Max[{}]!", this->path_name().c_str(), m_max.value());
+            return false;
+        }
+
+        if constexpr (CIntegerValueFieldType<_Type>) {
+            if (m_power_of_2 && ((f_value < _Type(2)) || (_Type(0) != ((f_value - _Type(1)) & f_value)))) {
+                SERROR("Invalid numeric field \"{}\" value({}) must be a power of 2! Min[2]!", this->path_name().c_str(), f_value);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //! Run the constraints over f_values[0, f_count), the built-in ones in one vectorized pass each
+    void bulk_check(const _Type* f_values, u64 f_count) {
+        if (m_min.has_value() || m_max.has_value()) {
+            const auto min = m_min.value_or(std::numeric_limits<_Type>::lowest());
+            const auto max = m_max.value_or(std::numeric_limits<_Type>::max());
+            report_failed(f_values, f_count, simd::find_out_of_range(f_values, 0ULL, f_count, min, max), [min, max](const _Type* f_values, u64 f_begin, u64 f_count) {
+                return simd::find_out_of_range(f_values, f_begin, f_count, min, max);
+            });
+        }
+
+        if constexpr (CIntegerValueFieldType<_Type>) {
+            if (m_power_of_2) {
+                report_failed(f_values, f_count, simd::find_not_power_of_2(f_values, 0ULL, f_count), [](const _Type* f_values, u64 f_begin, u64 f_count) {
+                    return simd::find_not_power_of_2(f_values, f_begin, f_count);
+                });
+            }
+        }
+
+        for (const auto& constraint : m_constraints) {
+            for (u64 i = 0ULL; i < f_count; ++i) {
+                if (false == constraint(*this, f_values[i])) {
+                    SERROR_LOCAL_T("Invalid value({}) at [{}] for numeric array\"{}\"!", f_values[i], i, this->path_name().c_str());
+                    throw std::runtime_error("NumericField<T> Invalid value");
+                }
+            }
+        }
+    }
+
+    //! Log the values failing a built-in constraint (the first ones and the total count) and throw, nothing if f_first == f_count
+    template <typename _Find>
+    void report_failed(const _Type* f_values, u64 f_count, u64 f_first, _Find&& f_find) const {
+        if (f_first == f_count) {
+            return;
+        }
+
+        constexpr u64 CMaxReported = 8ULL;
+
+        u64 failed = 0ULL;
+        for (u64 i = f_first; i < f_count; i = f_find(f_values, i + 1ULL, f_count)) {
+            if (failed < CMaxReported) {
+                (void)check_builtin_constraints(f_values[i]);
+                SERROR_LOCAL_T("Invalid value({}) at [{}] for numeric array\"{}\"!", f_values[i], i, this->path_name().c_str());
+            }
+            ++failed;
+        }
+
+        SERROR_LOCAL_T("Numeric array \"{}\" has {} invalid value(s)!", this->path_name().c_str(), failed);
+        throw std::runtime_error("NumericField<T> Invalid value");
+    }
+
 private:
     std::optional<_Type>          m_value;
     std::optional<_Type>          m_default;
+    std::optional<_Type>          m_min;
+    std::optional<_Type>          m_max;
     std::optional<raw_parsert_t>  m_custom_raw_parser;
     std::optional<json_parsert_t> m_custom_json_parser;
     std::optional<post_load_t>    m_post_load;
@@ -361,6 +566,7 @@ private:
     constraints_t                 m_constraints;
     bool                          m_required{false};
     bool                          m_validate_if_default{true};
+    bool                          m_power_of_2{false};
     bool                          m_is_default{false};
     bool                          m_is_validation_only{false};
 
@@ -53,14 +53,15 @@ public:
 
 private:
     //! Load the object value from json
-    void load(json& f_json) override {
-        const auto exists = f_json.contains(this->name());
+    void load(const json& f_json) override {
+        const auto it     = f_json.find(this->name());
+        const auto exists = f_json.end() != it;
         if (exists) {
-            if (f_json[this->name()].is_object()) {
-                m_config.load(f_json[this->name()]);
+            if (it->is_object()) {
+                m_config.load(*it);
                 m_is_default = false;
             } else {
-                SERROR_LOCAL_T("Field \"{}\" must be an object!\n\tjson: {}", this->path_name().c_str(), f_json[this->name()].dump().c_str());
+                SERROR_LOCAL_T("Field \"{}\" must be an object!\n\tjson: {}", this->path_name().c_str(), it->dump().c_str());
                 throw std::runtime_error("Wrong field type!");
             }
         } else {
@@ -95,6 +96,31 @@ private:
         m_config.submit(f_object.*m_member_ptr);
     }
 
+    [[nodiscard]] u64 load_cost(const json& f_json) const noexcept override {
+        const auto it = f_json.find(this->name());
+        if ((f_json.end() == it) || (false == it->is_object())) {
+            return 1ULL;
+        }
+
+        return std::max<u64>(1ULL, m_config.load_cost(*it));
+    }
+
+    void collect_length_limits(length_limit_node_t& f_parent) const override {
+        length_limit_node_t node{.m_name = std::string{this->name()}};
+        m_config.collect_length_limits(node);
+        if (false == node.empty()) {
+            f_parent.m_children.push_back(std::move(node));
+        }
+    }
+
+    [[nodiscard]] bool has_post_submit() const noexcept override {
+        return m_config.has_post_submit();
+    }
+
+    [[nodiscard]] u64 validate_cost() const noexcept override {
+        return std::max<u64>(1ULL, m_config.validate_cost());
+    }
+
     void load_value_from_default_object(const _TargetConfig& f_config) override {
         m_config.load_fields_from_default_object(f_config.*m_member_ptr);
         m_is_default         = true;
@@ -111,11 +137,38 @@ private:
         return std::make_unique<ObjectField<_Object, _TargetConfig>>(*this);
     }
 
+    void apply_filter(const path_filter_node_t* f_filter) override {
+        m_config.apply_filter(f_filter);
+    }
+
     void update_parent(Field& f_new_parent) noexcept override {
         Field::update_parent(f_new_parent);
         m_config.update_parent(f_new_parent);
     }
 
+    void serialize(const _TargetConfig& f_config, JsonWriter& f_writer) const override {
+        f_writer.key(this->name());
+        m_config.serialize(f_config.*m_member_ptr, f_writer);
+    }
+
+    void hash_schema(SchemaHasher& f_hasher) const override {
+        f_hasher.add_type<ObjectField<_Object, _TargetConfig>>();
+        f_hasher.add_string(this->name());
+        f_hasher.add(m_default.has_value());
+        f_hasher.add(m_required);
+        m_config.hash_schema(f_hasher);
+    }
+
+    void save_state(SnapshotWriter& f_writer) const override {
+        m_config.save_state(f_writer);
+    }
+
+    void load_state(SnapshotReader& f_reader) override {
+        m_config.load_state(f_reader);
+        m_is_default         = false;
+        m_is_validation_only = false;
+    }
+
 private:
     member_ptr_t           m_member_ptr;
     ConfigNode<_Object>    m_config;
@@ -0,0 +1,182 @@
+//!
+//! \file parse_cache
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <skl_log>
+#include <skl_string_view>
+
+#include "skl_config_internal/snapshot.hpp"
+#include "skl_config_internal/source_file.hpp"
+
+#define SKL_LOG_TAG ""
+
+namespace skl::config {
+//! Key of a parse cache entry, any mismatch is a cache miss
+struct parse_cache_key_t {
+    file_identity_t m_file;
+    u64             m_content_hash{0ULL};
+    u64             m_salt{0ULL};
+};
+
+//! Identity of the running executable (inode, mtime and size of /proc/self/exe)
+//! \remark Part of the cache key so that a rebuilt binary (possibly with changed constraint lambdas) never reuses old entries
+[[nodiscard]] inline u64 executable_identity() noexcept {
+    static const u64 identity = []() noexcept -> u64 {
+        struct stat info{};
+        if (0 != ::stat("/proc/self/exe", &info)) {
+            return 0ULL;
+        }
+
+        SchemaHasher hasher{};
+        hasher.add(static_cast<u64>(info.st_dev));
+        hasher.add(static_cast<u64>(info.st_ino));
+        hasher.add(static_cast<u64>(info.st_size));
+        hasher.add(static_cast<u64>(info.st_mtim.tv_sec));
+        hasher.add(static_cast<u64>(info.st_mtim.tv_nsec));
+        return hasher.value();
+    }();
+
+    return identity;
+}
+
+//! On-disk cache of validated loader state, keyed by file identity and content hash
+class ParseCache {
+public:
+    static constexpr u32 CMagic   = 0x434c4b53U; // "SKLC"
+    static constexpr u32 CVersion = 1U;
+
+    explicit ParseCache(std::string f_directory) noexcept
+        : m_directory(std::move(f_directory)) { }
+
+    [[nodiscard]] const std::string& directory() const noexcept {
+        return m_directory;
+    }
+
+    //! Build the key for the given source file contents
+    //! \param f_salt Caller specific salt (eg. the preprocessor type)
+    [[nodiscard]] static parse_cache_key_t make_key(const file_identity_t& f_identity, std::string_view f_source, u64 f_salt) noexcept {
+        return parse_cache_key_t{
+            .m_file         = f_identity,
+            .m_content_hash = hash_bytes(f_source.data(), f_source.size()),
+            .m_salt         = f_salt ^ executable_identity()};
+    }
+
+    //! Load the cached state for \p f_file into \p f_out_payload
+    //! \returns true on a hit, false on any miss or mismatch
+    [[nodiscard]] bool lookup(skl_string_view          f_file,
+                              const parse_cache_key_t& f_key,
+                              u64                      f_schema_fingerprint,
+                              std::vector<u8>&         f_out_payload) const {
+        std::ifstream stream{entry_path(f_file), std::ios::binary};
+        if (false == stream.is_open()) {
+            return false;
+        }
+
+        header_t header{};
+        if (false == static_cast<bool>(stream.read(reinterpret_cast<char*>(&header), sizeof(header)))) {
+            return false;
+        }
+
+        if ((CMagic != header.m_magic)
+            || (CVersion != header.m_version)
+            || (f_schema_fingerprint != header.m_schema_fingerprint)
+            || (f_key.m_file.m_device != header.m_key.m_file.m_device)
+            || (f_key.m_file.m_inode != header.m_key.m_file.m_inode)
+            || (f_key.m_file.m_mtime_ns != header.m_key.m_file.m_mtime_ns)
+            || (f_key.m_file.m_size != header.m_key.m_file.m_size)
+            || (f_key.m_content_hash != header.m_key.m_content_hash)
+            || (f_key.m_salt != header.m_key.m_salt)) {
+            return false;
+        }
+
+        f_out_payload.resize(header.m_payload_size);
+        if (false == static_cast<bool>(stream.read(reinterpret_cast<char*>(f_out_payload.data()), static_cast<std::streamsize>(header.m_payload_size)))) {
+            return false;
+        }
+
+        return header.m_payload_hash == hash_bytes(f_out_payload.data(), f_out_payload.size());
+    }
+
+    //! Store the state for \p f_file, best effort (failures only disable caching for this entry)
+    void store(skl_string_view          f_file,
+               const parse_cache_key_t& f_key,
+               u64                      f_schema_fingerprint,
+               std::span<const u8>      f_payload) const noexcept {
+        try {
+            std::error_code error{};
+            (void)std::filesystem::create_directories(m_directory, error);
+
+            const auto path      = entry_path(f_file);
+            const auto temp_path = path + ".tmp." + std::to_string(::getpid()) + "." + std::to_string(next_temp_file_id());
+
+            const header_t header{
+                .m_magic              = CMagic,
+                .m_version            = CVersion,
+                .m_schema_fingerprint = f_schema_fingerprint,
+                .m_key                = f_key,
+                .m_payload_size       = f_payload.size(),
+                .m_payload_hash       = hash_bytes(f_payload.data(), f_payload.size())};
+
+            {
+                std::ofstream stream{temp_path, std::ios::binary | std::ios::trunc};
+                if (false == stream.is_open()) {
+                    return;
+                }
+
+                (void)stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                (void)stream.write(reinterpret_cast<const char*>(f_payload.data()), static_cast<std::streamsize>(f_payload.size()));
+                if (false == static_cast<bool>(stream.flush())) {
+                    (void)std::filesystem::remove(temp_path, error);
+                    return;
+                }
+            }
+
+            // Atomic replace, concurrent readers see either the old or the new entry
+            std::filesystem::rename(temp_path, path, error);
+            if (error) {
+                (void)std::filesystem::remove(temp_path, error);
+            }
+        } catch (...) {
+            // Caching is an optimization only
+        }
+    }
+
+private:
+    struct header_t {
+        u32               m_magic;
+        u32               m_version;
+        u64               m_schema_fingerprint;
+        parse_cache_key_t m_key;
+        u64               m_payload_size;
+        u64               m_payload_hash;
+    };
+
+    //! One entry per source file path
+    [[nodiscard]] std::string entry_path(skl_string_view f_file) const {
+        std::error_code error{};
+        auto            absolute = std::filesystem::absolute(f_file.std<std::string_view>(), error);
+        const auto      source   = error ? std::string{f_file.std<std::string_view>()} : absolute.lexically_normal().string();
+
+        char name[32U];
+        (void)std::snprintf(name, sizeof(name), "%016llx.sklcache", static_cast<unsigned long long>(hash_string(source)));
+
+        return (std::filesystem::path{m_directory} / name).string();
+    }
+
+private:
+    std::string m_directory;
+};
+} // namespace skl::config
+
+#undef SKL_LOG_TAG
@@ -0,0 +1,170 @@
+//!
+//! \file path_filter
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "skl_config_internal/json_scan.hpp"
+
+namespace skl::config {
+//! Node of a path filter tree, one per selected member name
+struct path_filter_node_t {
+    std::string                     m_name;
+    std::vector<path_filter_node_t> m_children;
+    bool                            m_all{false}; //!< The whole subtree is selected
+
+    [[nodiscard]] const path_filter_node_t* find(std::string_view f_name) const noexcept {
+        for (const auto& child : m_children) {
+            if (f_name == child.m_name) {
+                return &child;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+//! Selects the config members to load, eg. {"obj:inner_obj[]", "ip_addr"}
+//! \remark Paths are member names separated by ':', the "[]" array suffix is optional (elements share the array's selection)
+//! \remark Selecting a member selects its whole subtree, selecting a nested member selects only that member of its parents
+class PathFilter {
+public:
+    PathFilter() noexcept = default;
+
+    PathFilter(std::initializer_list<std::string_view> f_paths) {
+        for (const auto path : f_paths) {
+            include(path);
+        }
+    }
+
+    //! Add a path to the selection
+    PathFilter& include(std::string_view f_path) {
+        auto* node = &m_root;
+        while (false == node->m_all) {
+            const auto separator = f_path.find(':');
+            auto       name      = f_path.substr(0ULL, separator);
+            if (name.ends_with("[]")) {
+                name.remove_suffix(2ULL);
+            }
+
+            auto* child = const_cast<path_filter_node_t*>(node->find(name));
+            if (nullptr == child) {
+                child         = &node->m_children.emplace_back();
+                child->m_name = name;
+            }
+
+            node = child;
+            if (std::string_view::npos == separator) {
+                node->m_all = true;
+                node->m_children.clear();
+                break;
+            }
+
+            f_path.remove_prefix(separator + 1ULL);
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]] const path_filter_node_t& root() const noexcept {
+        return m_root;
+    }
+
+    //! Parse only the selected members of f_source, the others are skipped by a structural scan without being decoded
+    //! \remark Falls back to a full parse if the source does not scan cleanly (the parser then reports the error)
+    [[nodiscard]] nlohmann::json parse(std::string_view f_source) const {
+        JsonScanner scanner{f_source};
+        const auto  members = scanner.top_level_members();
+        if (members.has_value()) {
+            auto result = parse_members(f_source, scanner, members.value(), m_root);
+            if (result.has_value()) {
+                return std::move(result.value());
+            }
+        }
+
+        return nlohmann::json::parse(f_source,
+            /* callback */ nullptr,
+            /* allow_exceptions */ true,
+            /* ignore_comments */ true);
+    }
+
+private:
+    [[nodiscard]] static std::optional<nlohmann::json> parse_members(std::string_view                  f_source,
+                                                                     JsonScanner&                      f_scanner,
+                                                                     const std::vector<json_member_t>& f_members,
+                                                                     const path_filter_node_t&         f_node) {
+        auto result = nlohmann::json::object();
+        for (const auto& member : f_members) {
+            const path_filter_node_t* selected = nullptr;
+            if (std::string_view::npos == member.m_key.find('\\')) {
+                selected = f_node.find(member.m_key);
+            } else {
+                // Escaped key, decode it to compare
+                const auto key_begin = static_cast<u64>(member.m_key.data() - f_source.data()) - 1ULL;
+                selected             = f_node.find(parse_json_slice(f_source, json_span_t{key_begin, key_begin + member.m_key.size() + 2ULL}).get_ref<const std::string&>());
+            }
+
+            if (nullptr == selected) {
+                continue;
+            }
+
+            auto value = parse_value(f_source, f_scanner, member.m_value, *selected);
+            if (false == value.has_value()) {
+                return std::nullopt;
+            }
+
+            result[selected->m_name] = std::move(value.value());
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] static std::optional<nlohmann::json> parse_value(std::string_view          f_source,
+                                                                   JsonScanner&              f_scanner,
+                                                                   json_span_t               f_value,
+                                                                   const path_filter_node_t& f_node) {
+        const char first = f_source[f_value.m_begin];
+        if (f_node.m_all || (('{' != first) && ('[' != first))) {
+            return parse_json_slice(f_source, f_value);
+        }
+
+        if ('{' == first) {
+            const auto members = f_scanner.object_members(f_value);
+            if (false == members.has_value()) {
+                return std::nullopt;
+            }
+
+            return parse_members(f_source, f_scanner, members.value(), f_node);
+        }
+
+        const auto elements = f_scanner.array_elements(f_value);
+        if (false == elements.has_value()) {
+            return std::nullopt;
+        }
+
+        auto result = nlohmann::json::array();
+        for (const auto element : elements.value()) {
+            auto value = parse_value(f_source, f_scanner, element, f_node);
+            if (false == value.has_value()) {
+                return std::nullopt;
+            }
+
+            result.push_back(std::move(value.value()));
+        }
+
+        return result;
+    }
+
+private:
+    path_filter_node_t m_root;
+};
+} // namespace skl::config
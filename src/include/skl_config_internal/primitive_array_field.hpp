@@ -7,6 +7,7 @@
 
 #include <skl_log>
 #include <skl_traits/conditional_t>
+#include <type_traits>
 
 #include "skl_config_internal/numeric_field.hpp"
 #include "skl_config_internal/string_field.hpp"
@@ -35,6 +36,9 @@ public:
     using member_ptr_t = _Container _TargetConfig::*;
     using field_t      = field_selector_t<_Object>::type;
 
+    //! Element type of the streaming staging container (the value itself unless it is a char buffer)
+    using staged_t = std::conditional_t<is_string_buffer<_Object>::value, field_value_proxy_t, _Object>;
+
     static constexpr bool CIsATRPContainer      = CATRPContainerType<_Container>;
     static constexpr bool CIsResizableContainer = CResizableContainerType<_Container>;
 
@@ -91,6 +95,13 @@ public:
         return *this;
     }
 
+    //! Decode, validate and submit one element at a time into a staging container that is moved into the target on submit
+    //! \remark Bounds memory to the target container, an elements count above max_length is rejected before decoding
+    PrimitiveArrayField& streaming(bool f_streaming) noexcept {
+        m_streaming = f_streaming;
+        return *this;
+    }
+
     [[nodiscard]] field_t& field() noexcept {
         return m_field_proto;
     }
@@ -105,19 +116,38 @@ public:
 
 private:
     //! Load the object value from json
-    void load(json& f_json) override {
+    void load(const json& f_json) override {
         m_entries.clear();
+        m_staging.clear();
+        m_is_staged = false;
+        m_is_bulk   = false;
 
-        const auto exists = f_json.contains(this->name());
+        const auto it     = f_json.find(this->name());
+        const auto exists = f_json.end() != it;
         if (exists) {
-            if (f_json[this->name()].is_array()) {
-                for (auto& entry : f_json[this->name()]) {
-                    m_entries.push_back(m_field_proto);
-                    m_entries.back().load(entry);
+            const auto& array = *it;
+            if (array.is_array()) {
+                auto* executor = this->executor();
+                if (m_streaming) {
+                    load_streaming(array);
+                } else if (is_bulk_decodable()) {
+                    load_bulk(array);
+                } else if ((nullptr != executor) && (array.size() >= CParallelMinCost)) {
+                    m_entries.assign(array.size(), m_field_proto);
+                    parallel_for(*executor, m_entries.size(), CParallelMinCost / 4ULL, [this, &array](u64 f_begin, u64 f_end) {
+                        for (u64 i = f_begin; i < f_end; ++i) {
+                            m_entries[i].load(array[i]);
+                        }
+                    });
+                } else {
+                    for (const auto& entry : array) {
+                        m_entries.push_back(m_field_proto);
+                        m_entries.back().load(entry);
+                    }
                 }
                 m_is_default = false;
             } else {
-                SERROR_LOCAL_T("Field \"{}\" must be an array!\n\tjson: {}", this->path_name().c_str(), f_json[this->name()].dump().c_str());
+                SERROR_LOCAL_T("Field \"{}\" must be an array!\n\tjson: {}", this->path_name().c_str(), it->dump().c_str());
                 throw std::runtime_error("Wrong field type!");
             }
         } else {
@@ -139,6 +169,28 @@ private:
 
     //! Validate the field value
     void validate() override {
+        prepare_validate();
+        if (m_is_staged) {
+            validate_staged();
+            return;
+        }
+
+        auto* executor = this->executor();
+        if ((nullptr != executor) && (m_entries.size() >= CParallelMinCost)) {
+            parallel_for(*executor, m_entries.size(), CParallelMinCost / 4ULL, [this](u64 f_begin, u64 f_end) {
+                for (u64 i = f_begin; i < f_end; ++i) {
+                    m_entries[i].validate();
+                }
+            });
+        } else {
+            for (auto& entry : m_entries) {
+                entry.validate();
+            }
+        }
+    }
+
+    //! Materialize the default entries (if any) and check the elements count
+    void prepare_validate() {
         if (m_is_default) {
             SKL_ASSERT(m_default.has_value());
 
@@ -150,13 +202,191 @@ private:
             }
         }
 
-        if ((m_entries.size() < m_min_length) || (m_entries.size() > m_max_length)) {
+        const auto count = m_is_staged ? m_staging.size() : m_entries.size();
+        if ((count < m_min_length) || (count > m_max_length)) {
             SERROR_LOCAL_T("Array field \"{}\" elements count must be in [min={}, max={}]!", this->path_name().c_str(), m_min_length, m_max_length);
             throw std::runtime_error("Array field has invalid length!");
         }
+    }
+
+    //! Are the elements plain numbers, decoded straight into the staging container by load_bulk()
+    [[nodiscard]] bool is_bulk_decodable() const noexcept {
+        if constexpr (CNumericValueFieldType<_Object>) {
+            return m_field_proto.is_bulk_decodable();
+        } else {
+            return false;
+        }
+    }
 
-        for (auto& entry : m_entries) {
-            entry.validate();
+    //! Decode all the elements into the contiguous staging container, no per element field
+    //! \remark The element constraints are run over the whole container by validate()
+    void load_bulk(const json& f_array) {
+        if constexpr (CNumericValueFieldType<_Object>) {
+            m_staging.resize(f_array.size());
+
+            auto* executor = this->executor();
+            if ((nullptr != executor) && (f_array.size() >= CParallelMinCost * 16ULL)) {
+                parallel_for(*executor, f_array.size(), CParallelMinCost * 4ULL, [this, &f_array](u64 f_begin, u64 f_end) {
+                    m_field_proto.bulk_decode(f_array, f_begin, f_end, m_staging.data() + f_begin);
+                });
+            } else {
+                m_field_proto.bulk_decode(f_array, 0ULL, f_array.size(), m_staging.data());
+            }
+
+            m_is_staged = true;
+            m_is_bulk   = true;
+        }
+    }
+
+    //! Check the bulk decoded elements, streamed elements were already validated while streaming
+    void validate_staged() {
+        if constexpr (CNumericValueFieldType<_Object>) {
+            if (m_is_bulk) {
+                m_field_proto.bulk_check(m_staging.data(), m_staging.size());
+            }
+        }
+    }
+
+    //! Decode, validate and stage the elements one by one, reusing a single field
+    void load_streaming(const json& f_array) {
+        if (f_array.size() > m_max_length) {
+            SERROR_LOCAL_T("Array field \"{}\" elements count({}) exceeds max={}!", this->path_name().c_str(), f_array.size(), m_max_length);
+            throw std::runtime_error("Array field has invalid length!");
+        }
+
+        m_staging.reserve(f_array.size());
+
+        field_t field{m_field_proto};
+        for (const auto& entry : f_array) {
+            field.reset();
+            field.load(entry);
+            field.validate();
+            stage(field);
+        }
+
+        m_is_staged = true;
+    }
+
+    void stage(field_t& f_field) {
+        field_value_proxy_t proxy{};
+        f_field.submit(proxy);
+
+        if constexpr (__is_same(staged_t, field_value_proxy_t)) {
+            m_staging.emplace_back(std::move(proxy));
+        } else {
+            m_staging.emplace_back(std::move(proxy.value));
+        }
+    }
+
+    [[nodiscard]] static _Object& staged_value(staged_t& f_staged) noexcept {
+        if constexpr (__is_same(staged_t, field_value_proxy_t)) {
+            return f_staged.value;
+        } else {
+            return f_staged;
+        }
+    }
+
+    //! Move the staged elements into the target container
+    void submit_staged(_Container& f_field) {
+        if constexpr (__is_same(_Container, std::vector<staged_t>)) {
+            f_field = std::move(m_staging);
+            m_staging.clear();
+        } else {
+            if constexpr (CIsATRPContainer) {
+                f_field.upgrade().clear();
+            } else {
+                f_field.clear();
+            }
+
+            if constexpr (CIsResizableContainer) {
+                if constexpr (CIsATRPContainer) {
+                    f_field.upgrade().resize(m_staging.size());
+                } else {
+                    f_field.resize(m_staging.size());
+                }
+
+                for (u64 i = 0ULL; i < f_field.size(); ++i) {
+                    f_field[i] = std::move(staged_value(m_staging[i]));
+                }
+            } else {
+                if (m_staging.size() > f_field.capacity()) {
+                    if (false == m_truncate_on_overflow) {
+                        SERROR_LOCAL_T("Array field \"{}\" elements count({}) does not fit in the target fixed capacity({}) container!", this->path_name().c_str(), m_staging.size(), f_field.capacity());
+                        throw std::runtime_error("Array elements overflow the target container!");
+                    }
+                }
+
+                for (u64 i = 0ULL; i < std::min(f_field.capacity(), m_staging.size()); ++i) {
+                    if constexpr (CIsATRPContainer) {
+                        (void)f_field.upgrade().emplace_back(std::move(staged_value(m_staging[i])));
+                    } else {
+                        f_field.emplace_back(std::move(staged_value(m_staging[i])));
+                    }
+                }
+            }
+
+            m_staging.clear();
+        }
+    }
+
+    bool load_step(const json& f_json, u64 f_step) override {
+        if (0ULL == f_step) {
+            const auto it = f_json.find(this->name());
+            if (m_streaming || is_bulk_decodable() || (f_json.end() == it) || (false == it->is_array())) {
+                // Streamed, bulk decoded, missing, defaulted or invalid, nothing to split
+                load(f_json);
+                return true;
+            }
+
+            m_entries.clear();
+            m_entries.reserve(it->size());
+            m_is_default         = false;
+            m_is_validation_only = false;
+            return it->empty();
+        }
+
+        const auto& array = f_json.at(this->name());
+        m_entries.push_back(m_field_proto);
+        m_entries.back().load(array[f_step - 1ULL]);
+        return f_step == array.size();
+    }
+
+    bool validate_step(u64 f_step) override {
+        if (0ULL == f_step) {
+            prepare_validate();
+            if (m_is_staged) {
+                validate_staged();
+                return true;
+            }
+
+            return m_entries.empty();
+        }
+
+        m_entries[f_step - 1ULL].validate();
+        return f_step == m_entries.size();
+    }
+
+    [[nodiscard]] u64 load_cost(const json& f_json) const noexcept override {
+        const auto it = f_json.find(this->name());
+        if ((f_json.end() == it) || (false == it->is_array())) {
+            return 1ULL;
+        }
+
+        return std::max<u64>(1ULL, it->size());
+    }
+
+    [[nodiscard]] u64 validate_cost() const noexcept override {
+        return std::max<u64>(1ULL, m_is_staged ? m_staging.size() : m_entries.size());
+    }
+
+    //! Streaming arrays are rejected while parsed, before a longer than max_length array is built
+    void collect_length_limits(length_limit_node_t& f_parent) const override {
+        if (m_streaming && (std::numeric_limits<u32>::max() != m_max_length)) {
+            f_parent.m_children.push_back(length_limit_node_t{
+                .m_name       = std::string{this->name()},
+                .m_path       = path_name(),
+                .m_children   = {},
+                .m_max_length = m_max_length});
         }
     }
 
@@ -164,6 +394,11 @@ private:
     void submit(_TargetConfig& f_config) override {
         auto& field = f_config.*m_member_ptr;
 
+        if (m_is_staged) {
+            submit_staged(field);
+            return;
+        }
+
         if constexpr (CIsATRPContainer) {
             field.upgrade().clear();
         } else {
@@ -208,6 +443,9 @@ private:
 
         m_entries.clear();
         m_entries.reserve(field.size());
+        m_staging.clear();
+        m_is_staged = false;
+        m_is_bulk   = false;
 
         for (const auto& entry : field) {
             m_entries.emplace_back(m_field_proto);
@@ -224,6 +462,9 @@ private:
 
         m_entries.clear();
         m_entries.reserve(field.size());
+        m_staging.clear();
+        m_is_staged = false;
+        m_is_bulk   = false;
 
         for (const auto& entry : field) {
             m_entries.emplace_back(m_field_proto);
@@ -248,8 +489,82 @@ private:
         }
     }
 
+    void serialize(const _TargetConfig& f_config, JsonWriter& f_writer) const override {
+        f_writer.key(this->name());
+        f_writer.begin_array();
+        for (const auto& entry : f_config.*m_member_ptr) {
+            field_t::serialize_value(entry, f_writer);
+        }
+        f_writer.end_array();
+    }
+
+    void hash_schema(SchemaHasher& f_hasher) const override {
+        f_hasher.add_type<PrimitiveArrayField<_Object, _TargetConfig, _Container>>();
+        f_hasher.add_string(this->name());
+        f_hasher.add(m_default.has_value());
+        if (m_default.has_value()) {
+            f_hasher.add(m_default->size());
+        }
+        f_hasher.add(m_min_length);
+        f_hasher.add(m_max_length);
+        f_hasher.add(m_required);
+        f_hasher.add(m_truncate_on_overflow);
+        f_hasher.add(m_streaming);
+        m_field_proto.hash_schema(f_hasher);
+    }
+
+    void save_state(SnapshotWriter& f_writer) const override {
+        if (m_is_staged) {
+            // Same layout as the entries, the staged values are re-read through a field
+            f_writer.write_size(m_staging.size());
+
+            field_t field{m_field_proto};
+            for (const auto& staged : m_staging) {
+                field_value_proxy_t temp{.value = staged_value(const_cast<staged_t&>(staged))};
+                field.load_value_from_default_object(temp);
+                field.save_state(f_writer);
+            }
+            return;
+        }
+
+        f_writer.write_size(m_entries.size());
+        for (const auto& entry : m_entries) {
+            entry.save_state(f_writer);
+        }
+    }
+
+    void load_state(SnapshotReader& f_reader) override {
+        const auto count = f_reader.read_size();
+
+        m_entries.clear();
+        m_staging.clear();
+        m_is_staged = m_streaming;
+        m_is_bulk   = false;
+
+        if (m_streaming) {
+            field_t field{m_field_proto};
+            m_staging.reserve(count);
+            for (u64 i = 0ULL; i < count; ++i) {
+                field.load_state(f_reader);
+                stage(field);
+            }
+        } else {
+            m_entries.reserve(count);
+            for (u64 i = 0ULL; i < count; ++i) {
+                m_entries.push_back(m_field_proto);
+                m_entries.back().load_state(f_reader);
+            }
+        }
+
+        m_is_default         = false;
+        m_is_validation_only = false;
+    }
+
     void reset() override {
         m_entries.clear();
+        m_staging.clear();
+        m_is_staged          = false;
+        m_is_bulk            = false;
         m_is_default         = false;
         m_is_validation_only = false;
     }
@@ -258,6 +573,7 @@ private:
     member_ptr_t                                    m_member_ptr;
     field_t                                         m_field_proto;
     std::vector<field_t>                            m_entries;
+    std::vector<staged_t>                           m_staging;
     std::optional<std::vector<field_value_proxy_t>> m_default;
     u32                                             m_min_length = 0U;
     u32                                             m_max_length = std::numeric_limits<u32>::max();
@@ -265,6 +581,9 @@ private:
     bool                                            m_is_default{false};
     bool                                            m_is_validation_only{false};
     bool                                            m_truncate_on_overflow{false};
+    bool                                            m_streaming{false};
+    bool                                            m_is_staged{false};
+    bool                                            m_is_bulk{false}; //!< Staged by load_bulk(), not yet checked
 };
 } // namespace skl::config
 
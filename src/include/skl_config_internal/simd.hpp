@@ -0,0 +1,452 @@
+//!
+//! \file simd
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <string_view>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#    define SKL_CONFIG_SIMD_X86 1
+#    define SKL_CONFIG_SIMD_TARGET(_Isa) __attribute__((target(_Isa)))
+#    include <immintrin.h>
+#else
+#    define SKL_CONFIG_SIMD_X86 0
+#endif
+
+#include "skl_config_internal/common.hpp"
+
+namespace skl::config {
+//! Kernels checking the built-in numeric constraints over contiguous values, and scanning json string contents
+//! \remark Each kernel returns the index of the first failing value in [f_begin, f_count), f_count if all pass
+//! \remark 32 bit values use the best variant the CPU supports (selected at runtime, see active_level()), other types the scalar kernels
+namespace simd {
+    //! Kernel variants, in increasing order of capability
+    enum class level_t : u8 {
+        scalar,
+        sse42,
+        avx2,
+        avx512
+    };
+
+    [[nodiscard]] constexpr std::string_view level_name(level_t f_level) noexcept {
+        switch (f_level) {
+            case level_t::sse42:
+                return "sse42";
+            case level_t::avx2:
+                return "avx2";
+            case level_t::avx512:
+                return "avx512";
+            default:
+                return "scalar";
+        }
+    }
+
+    [[nodiscard]] constexpr bool parse_level(std::string_view f_name, level_t& f_out_level) noexcept {
+        for (const auto level : {level_t::scalar, level_t::sse42, level_t::avx2, level_t::avx512}) {
+            if (level_name(level) == f_name) {
+                f_out_level = level;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //! Best variant supported by this CPU (cpuid, detected once)
+    [[nodiscard]] inline level_t detected_level() noexcept {
+        static const level_t CDetected = []() noexcept {
+#if SKL_CONFIG_SIMD_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) {
+                return level_t::avx512;
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                return level_t::avx2;
+            }
+            if (__builtin_cpu_supports("sse4.2")) {
+                return level_t::sse42;
+            }
+#endif
+            return level_t::scalar;
+        }();
+
+        return CDetected;
+    }
+
+    namespace detail {
+        //! Detected level, lowered by the SKL_CONFIG_SIMD environment variable (scalar, sse42, avx2 or avx512)
+        [[nodiscard]] inline level_t initial_level() noexcept {
+            const auto  detected = detected_level();
+            const char* name     = std::getenv("SKL_CONFIG_SIMD");
+            level_t     forced   = detected;
+            if ((nullptr == name) || (false == parse_level(name, forced))) {
+                return detected;
+            }
+
+            return (forced < detected) ? forced : detected;
+        }
+
+        [[nodiscard]] inline std::atomic<level_t>& level_storage() noexcept {
+            static std::atomic<level_t> level{initial_level()};
+            return level;
+        }
+    } // namespace detail
+
+    //! Variant used by the kernels
+    [[nodiscard]] inline level_t active_level() noexcept {
+        return detail::level_storage().load(std::memory_order_relaxed);
+    }
+
+    //! Select the variant used by the kernels (eg. to test every variant), clamped to detected_level()
+    //! \return The applied level
+    inline level_t set_active_level(level_t f_level) noexcept {
+        const auto level = (f_level < detected_level()) ? f_level : detected_level();
+        detail::level_storage().store(level, std::memory_order_relaxed);
+        return level;
+    }
+
+    //! Values checked per scalar block, the block loop has no early exit so the compiler can vectorize it
+    constexpr u64 CScalarBlock = 64ULL;
+
+    template <typename _Type>
+    [[nodiscard]] u64 find_out_of_range_scalar(const _Type* f_values, u64 f_begin, u64 f_count, _Type f_min, _Type f_max) noexcept {
+        u64 i = f_begin;
+        for (; (i + CScalarBlock) <= f_count; i += CScalarBlock) {
+            bool failed = false;
+            for (u64 j = 0ULL; j < CScalarBlock; ++j) {
+                const auto value = f_values[i + j];
+                failed |= (value < f_min) | (value > f_max);
+            }
+
+            if (failed) {
+                break;
+            }
+        }
+
+        for (; i < f_count; ++i) {
+            if ((f_values[i] < f_min) || (f_values[i] > f_max)) {
+                return i;
+            }
+        }
+
+        return f_count;
+    }
+
+    template <typename _Type>
+    [[nodiscard]] u64 find_not_power_of_2_scalar(const _Type* f_values, u64 f_begin, u64 f_count) noexcept {
+        u64 i = f_begin;
+        for (; (i + CScalarBlock) <= f_count; i += CScalarBlock) {
+            bool failed = false;
+            for (u64 j = 0ULL; j < CScalarBlock; ++j) {
+                const auto value = f_values[i + j];
+                failed |= (value < _Type(2)) | (_Type(0) != ((value - _Type(1)) & value));
+            }
+
+            if (failed) {
+                break;
+            }
+        }
+
+        for (; i < f_count; ++i) {
+            const auto value = f_values[i];
+            if ((value < _Type(2)) || (_Type(0) != ((value - _Type(1)) & value))) {
+                return i;
+            }
+        }
+
+        return f_count;
+    }
+
+    //! Must the character be escaped inside a json string (control character, quote or backslash)
+    [[nodiscard]] constexpr bool needs_json_escape(char f_char) noexcept {
+        const auto value = static_cast<u8>(f_char);
+        return (value < 0x20U) || (static_cast<u8>('"') == value) || (static_cast<u8>('\\') == value);
+    }
+
+    [[nodiscard]] inline u64 find_json_escape_scalar(const char* f_text, u64 f_begin, u64 f_count) noexcept {
+        u64 i = f_begin;
+        for (; (i + CScalarBlock) <= f_count; i += CScalarBlock) {
+            bool found = false;
+            for (u64 j = 0ULL; j < CScalarBlock; ++j) {
+                found |= needs_json_escape(f_text[i + j]);
+            }
+
+            if (found) {
+                break;
+            }
+        }
+
+        for (; i < f_count; ++i) {
+            if (needs_json_escape(f_text[i])) {
+                return i;
+            }
+        }
+
+        return f_count;
+    }
+
+#if SKL_CONFIG_SIMD_X86
+    // The vector kernels stop at the first failing step, the scalar kernel then finds the exact index (and does the tail)
+
+    template <typename _Type>
+    [[nodiscard]] SKL_CONFIG_SIMD_TARGET("avx512f") u64 find_out_of_range_avx512(const _Type* f_values, u64 f_begin, u64 f_count, _Type f_min, _Type f_max) noexcept {
+        u64 i = f_begin;
+        if constexpr (__is_same(_Type, float)) {
+            const auto min = _mm512_set1_ps(f_min);
+            const auto max = _mm512_set1_ps(f_max);
+            for (; (i + 16ULL) <= f_count; i += 16ULL) {
+                const auto values = _mm512_loadu_ps(f_values + i);
+                if (0U != (_mm512_cmp_ps_mask(values, min, _CMP_LT_OQ) | _mm512_cmp_ps_mask(values, max, _CMP_GT_OQ))) {
+                    break;
+                }
+            }
+        } else {
+            const auto min = _mm512_set1_epi32(static_cast<i32>(f_min));
+            const auto max = _mm512_set1_epi32(static_cast<i32>(f_max));
+            for (; (i + 16ULL) <= f_count; i += 16ULL) {
+                const auto values = _mm512_loadu_si512(f_values + i);
+                if constexpr (__is_same(_Type, u32)) {
+                    if (0U != (_mm512_cmplt_epu32_mask(values, min) | _mm512_cmpgt_epu32_mask(values, max))) {
+                        break;
+                    }
+                } else {
+                    if (0U != (_mm512_cmplt_epi32_mask(values, min) | _mm512_cmpgt_epi32_mask(values, max))) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        return find_out_of_range_scalar(f_values, i, f_count, f_min, f_max);
+    }
+
+    template <typename _Type>
+    [[nodiscard]] SKL_CONFIG_SIMD_TARGET("avx512f") u64 find_not_power_of_2_avx512(const _Type* f_values, u64 f_begin, u64 f_count) noexcept {
+        const auto one = _mm512_set1_epi32(1);
+        u64        i   = f_begin;
+        for (; (i + 16ULL) <= f_count; i += 16ULL) {
+            const auto values    = _mm512_loadu_si512(f_values + i);
+            const auto too_small = __is_same(_Type, u32) ? _mm512_cmple_epu32_mask(values, one) : _mm512_cmple_epi32_mask(values, one);
+            const auto not_pow2  = _mm512_test_epi32_mask(values, _mm512_sub_epi32(values, one));
+            if (0U != (too_small | not_pow2)) {
+                break;
+            }
+        }
+
+        return find_not_power_of_2_scalar(f_values, i, f_count);
+    }
+
+    template <typename _Type>
+    [[nodiscard]] SKL_CONFIG_SIMD_TARGET("avx2") u64 find_out_of_range_avx2(const _Type* f_values, u64 f_begin, u64 f_count, _Type f_min, _Type f_max) noexcept {
+        u64 i = f_begin;
+        if constexpr (__is_same(_Type, float)) {
+            const auto min = _mm256_set1_ps(f_min);
+            const auto max = _mm256_set1_ps(f_max);
+            for (; (i + 8ULL) <= f_count; i += 8ULL) {
+                const auto values = _mm256_loadu_ps(f_values + i);
+                const auto failed = _mm256_or_ps(_mm256_cmp_ps(values, min, _CMP_LT_OQ), _mm256_cmp_ps(values, max, _CMP_GT_OQ));
+                if (0 != _mm256_movemask_ps(failed)) {
+                    break;
+                }
+            }
+        } else {
+            const auto min = _mm256_set1_epi32(static_cast<i32>(f_min));
+            const auto max = _mm256_set1_epi32(static_cast<i32>(f_max));
+            for (; (i + 8ULL) <= f_count; i += 8ULL) {
+                const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(f_values + i));
+                if constexpr (__is_same(_Type, u32)) {
+                    // In range <=> max(v, min) == v && min(v, max) == v
+                    const auto passed = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(values, min), values),
+                                                         _mm256_cmpeq_epi32(_mm256_min_epu32(values, max), values));
+                    if (-1 != _mm256_movemask_epi8(passed)) {
+                        break;
+                    }
+                } else {
+                    const auto failed = _mm256_or_si256(_mm256_cmpgt_epi32(min, values), _mm256_cmpgt_epi32(values, max));
+                    if (0 != _mm256_movemask_epi8(failed)) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        return find_out_of_range_scalar(f_values, i, f_count, f_min, f_max);
+    }
+
+    template <typename _Type>
+    [[nodiscard]] SKL_CONFIG_SIMD_TARGET("avx2") u64 find_not_power_of_2_avx2(const _Type* f_values, u64 f_begin, u64 f_count) noexcept {
+        const auto zero = _mm256_setzero_si256();
+        const auto one  = _mm256_set1_epi32(1);
+        const auto two  = _mm256_set1_epi32(2);
+        u64        i    = f_begin;
+        for (; (i + 8ULL) <= f_count; i += 8ULL) {
+            const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(f_values + i));
+            const auto pow2   = _mm256_cmpeq_epi32(_mm256_and_si256(values, _mm256_sub_epi32(values, one)), zero);
+            const auto large  = __is_same(_Type, u32) ? _mm256_cmpeq_epi32(_mm256_max_epu32(values, two), values)
+                                                      : _mm256_cmpgt_epi32(values, one);
+            if (-1 != _mm256_movemask_epi8(_mm256_and_si256(pow2, large))) {
+                break;
+            }
+        }
+
+        return find_not_power_of_2_scalar(f_values, i, f_count);
+    }
+
+    template <typename _Type>
+    [[nodiscard]] SKL_CONFIG_SIMD_TARGET("sse4.2") u64 find_out_of_range_sse42(const _Type* f_values, u64 f_begin, u64 f_count, _Type f_min, _Type f_max) noexcept {
+        u64 i = f_begin;
+        if constexpr (__is_same(_Type, float)) {
+            const auto min = _mm_set1_ps(f_min);
+            const auto max = _mm_set1_ps(f_max);
+            for (; (i + 4ULL) <= f_count; i += 4ULL) {
+                const auto values = _mm_loadu_ps(f_values + i);
+                if (0 != _mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(values, min), _mm_cmpgt_ps(values, max)))) {
+                    break;
+                }
+            }
+        } else {
+            const auto min = _mm_set1_epi32(static_cast<i32>(f_min));
+            const auto max = _mm_set1_epi32(static_cast<i32>(f_max));
+            for (; (i + 4ULL) <= f_count; i += 4ULL) {
+                const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_values + i));
+                if constexpr (__is_same(_Type, u32)) {
+                    const auto passed = _mm_and_si128(_mm_cmpeq_epi32(_mm_max_epu32(values, min), values),
+                                                      _mm_cmpeq_epi32(_mm_min_epu32(values, max), values));
+                    if (0xFFFF != _mm_movemask_epi8(passed)) {
+                        break;
+                    }
+                } else {
+                    if (0 != _mm_movemask_epi8(_mm_or_si128(_mm_cmpgt_epi32(min, values), _mm_cmpgt_epi32(values, max)))) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        return find_out_of_range_scalar(f_values, i, f_count, f_min, f_max);
+    }
+
+    template <typename _Type>
+    [[nodiscard]] SKL_CONFIG_SIMD_TARGET("sse4.2") u64 find_not_power_of_2_sse42(const _Type* f_values, u64 f_begin, u64 f_count) noexcept {
+        const auto zero = _mm_setzero_si128();
+        const auto one  = _mm_set1_epi32(1);
+        const auto two  = _mm_set1_epi32(2);
+        u64        i    = f_begin;
+        for (; (i + 4ULL) <= f_count; i += 4ULL) {
+            const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_values + i));
+            const auto pow2   = _mm_cmpeq_epi32(_mm_and_si128(values, _mm_sub_epi32(values, one)), zero);
+            const auto large  = __is_same(_Type, u32) ? _mm_cmpeq_epi32(_mm_max_epu32(values, two), values)
+                                                      : _mm_cmpgt_epi32(values, one);
+            if (0xFFFF != _mm_movemask_epi8(_mm_and_si128(pow2, large))) {
+                break;
+            }
+        }
+
+        return find_not_power_of_2_scalar(f_values, i, f_count);
+    }
+
+    [[nodiscard]] SKL_CONFIG_SIMD_TARGET("avx2") inline u64 find_json_escape_avx2(const char* f_text, u64 f_begin, u64 f_count) noexcept {
+        const auto control   = _mm256_set1_epi8(0x1F);
+        const auto quote     = _mm256_set1_epi8('"');
+        const auto backslash = _mm256_set1_epi8('\\');
+        u64        i         = f_begin;
+        for (; (i + 32ULL) <= f_count; i += 32ULL) {
+            const auto text  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(f_text + i));
+            const auto found = _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(text, control), control),
+                                               _mm256_or_si256(_mm256_cmpeq_epi8(text, quote), _mm256_cmpeq_epi8(text, backslash)));
+            const auto mask  = static_cast<u32>(_mm256_movemask_epi8(found));
+            if (0U != mask) {
+                return i + static_cast<u64>(__builtin_ctz(mask));
+            }
+        }
+
+        return find_json_escape_scalar(f_text, i, f_count);
+    }
+
+    [[nodiscard]] SKL_CONFIG_SIMD_TARGET("sse4.2") inline u64 find_json_escape_sse42(const char* f_text, u64 f_begin, u64 f_count) noexcept {
+        const auto control   = _mm_set1_epi8(0x1F);
+        const auto quote     = _mm_set1_epi8('"');
+        const auto backslash = _mm_set1_epi8('\\');
+        u64        i         = f_begin;
+        for (; (i + 16ULL) <= f_count; i += 16ULL) {
+            const auto text  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_text + i));
+            const auto found = _mm_or_si128(_mm_cmpeq_epi8(_mm_max_epu8(text, control), control),
+                                            _mm_or_si128(_mm_cmpeq_epi8(text, quote), _mm_cmpeq_epi8(text, backslash)));
+            const auto mask  = static_cast<u32>(_mm_movemask_epi8(found));
+            if (0U != mask) {
+                return i + static_cast<u64>(__builtin_ctz(mask));
+            }
+        }
+
+        return find_json_escape_scalar(f_text, i, f_count);
+    }
+#endif
+
+    template <typename _Type>
+    constexpr bool CHasVectorKernels = __is_same(_Type, u32) || __is_same(_Type, i32) || __is_same(_Type, float);
+
+    //! Index of the first value outside [f_min, f_max] in [f_begin, f_count), f_count if none
+    template <typename _Type>
+    [[nodiscard]] u64 find_out_of_range(const _Type* f_values, u64 f_begin, u64 f_count, _Type f_min, _Type f_max) noexcept {
+#if SKL_CONFIG_SIMD_X86
+        if constexpr (CHasVectorKernels<_Type>) {
+            switch (active_level()) {
+                case level_t::avx512:
+                    return find_out_of_range_avx512(f_values, f_begin, f_count, f_min, f_max);
+                case level_t::avx2:
+                    return find_out_of_range_avx2(f_values, f_begin, f_count, f_min, f_max);
+                case level_t::sse42:
+                    return find_out_of_range_sse42(f_values, f_begin, f_count, f_min, f_max);
+                default:
+                    break;
+            }
+        }
+#endif
+
+        return find_out_of_range_scalar(f_values, f_begin, f_count, f_min, f_max);
+    }
+
+    //! Index of the first value that is not a power of 2 (or is < 2) in [f_begin, f_count), f_count if none
+    template <typename _Type>
+    [[nodiscard]] u64 find_not_power_of_2(const _Type* f_values, u64 f_begin, u64 f_count) noexcept {
+#if SKL_CONFIG_SIMD_X86
+        if constexpr (CHasVectorKernels<_Type> && (false == __is_same(_Type, float))) {
+            switch (active_level()) {
+                case level_t::avx512:
+                    return find_not_power_of_2_avx512(f_values, f_begin, f_count);
+                case level_t::avx2:
+                    return find_not_power_of_2_avx2(f_values, f_begin, f_count);
+                case level_t::sse42:
+                    return find_not_power_of_2_sse42(f_values, f_begin, f_count);
+                default:
+                    break;
+            }
+        }
+#endif
+
+        return find_not_power_of_2_scalar(f_values, f_begin, f_count);
+    }
+
+    //! Index of the first character to escape in a json string in [f_begin, f_count), f_count if none
+    //! \remark The avx512 level uses the avx2 kernel (byte compares need avx512bw)
+    [[nodiscard]] inline u64 find_json_escape(const char* f_text, u64 f_begin, u64 f_count) noexcept {
+#if SKL_CONFIG_SIMD_X86
+        switch (active_level()) {
+            case level_t::avx512:
+            case level_t::avx2:
+                return find_json_escape_avx2(f_text, f_begin, f_count);
+            case level_t::sse42:
+                return find_json_escape_sse42(f_text, f_begin, f_count);
+            default:
+                break;
+        }
+#endif
+
+        return find_json_escape_scalar(f_text, f_begin, f_count);
+    }
+} // namespace simd
+} // namespace skl::config
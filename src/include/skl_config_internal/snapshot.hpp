@@ -0,0 +1,290 @@
+//!
+//! \file snapshot
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "skl_config_internal/common.hpp"
+
+namespace skl::config {
+constexpr u64 CFnvOffsetBasis = 0xcbf29ce484222325ULL;
+constexpr u64 CFnvPrime       = 0x100000001b3ULL;
+
+//! Constexpr FNV-1a over a string, used for names and type signatures
+[[nodiscard]] constexpr u64 hash_string(std::string_view f_string, u64 f_seed = CFnvOffsetBasis) noexcept {
+    u64 hash = f_seed;
+    for (const char c : f_string) {
+        hash ^= static_cast<u8>(c);
+        hash *= CFnvPrime;
+    }
+    return hash;
+}
+
+//! Stable per-type fingerprint derived from the compiler's signature of this function
+template <typename _Type>
+[[nodiscard]] constexpr u64 type_fingerprint() noexcept {
+    return hash_string(__PRETTY_FUNCTION__);
+}
+
+//! Fast non-cryptographic hash over a byte range (xxh64 style, 4 lanes of 8 bytes)
+[[nodiscard]] inline u64 hash_bytes(const void* f_data, u64 f_size, u64 f_seed = 0ULL) noexcept {
+    constexpr u64 CPrime1 = 0x9E3779B185EBCA87ULL;
+    constexpr u64 CPrime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr u64 CPrime3 = 0x165667B19E3779F9ULL;
+    constexpr u64 CPrime4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr u64 CPrime5 = 0x27D4EB2F165667C5ULL;
+
+    const auto rotl = [](u64 f_value, u32 f_bits) noexcept { return (f_value << f_bits) | (f_value >> (64U - f_bits)); };
+    const auto load = [](const u8* f_ptr) noexcept { u64 value; std::memcpy(&value, f_ptr, sizeof(value)); return value; };
+    const auto round = [&](u64 f_acc, u64 f_input) noexcept { return rotl(f_acc + (f_input * CPrime2), 31U) * CPrime1; };
+
+    const auto* ptr = static_cast<const u8*>(f_data);
+    const auto* end = ptr + f_size;
+    u64         hash;
+
+    if (f_size >= 32ULL) {
+        u64 v1 = f_seed + CPrime1 + CPrime2;
+        u64 v2 = f_seed + CPrime2;
+        u64 v3 = f_seed;
+        u64 v4 = f_seed - CPrime1;
+
+        do {
+            v1 = round(v1, load(ptr));
+            v2 = round(v2, load(ptr + 8));
+            v3 = round(v3, load(ptr + 16));
+            v4 = round(v4, load(ptr + 24));
+            ptr += 32;
+        } while (ptr + 32 <= end);
+
+        hash = rotl(v1, 1U) + rotl(v2, 7U) + rotl(v3, 12U) + rotl(v4, 18U);
+        hash = ((hash ^ round(0ULL, v1)) * CPrime1) + CPrime4;
+        hash = ((hash ^ round(0ULL, v2)) * CPrime1) + CPrime4;
+        hash = ((hash ^ round(0ULL, v3)) * CPrime1) + CPrime4;
+        hash = ((hash ^ round(0ULL, v4)) * CPrime1) + CPrime4;
+    } else {
+        hash = f_seed + CPrime5;
+    }
+
+    hash += f_size;
+
+    while (ptr + 8 <= end) {
+        hash ^= round(0ULL, load(ptr));
+        hash = (rotl(hash, 27U) * CPrime1) + CPrime4;
+        ptr += 8;
+    }
+
+    while (ptr < end) {
+        hash ^= (*ptr) * CPrime5;
+        hash = rotl(hash, 11U) * CPrime1;
+        ++ptr;
+    }
+
+    hash ^= hash >> 33U;
+    hash *= CPrime2;
+    hash ^= hash >> 29U;
+    hash *= CPrime3;
+    hash ^= hash >> 32U;
+
+    return hash;
+}
+
+//! Accumulates the structural fingerprint of a schema (field names, kinds, types and options)
+class SchemaHasher {
+public:
+    void add(u64 f_value) noexcept {
+        m_hash ^= f_value + 0x9E3779B97F4A7C15ULL + (m_hash << 6U) + (m_hash >> 2U);
+    }
+
+    void add_string(std::string_view f_string) noexcept {
+        add(hash_string(f_string));
+    }
+
+    template <typename _Type>
+    void add_type() noexcept {
+        add(type_fingerprint<_Type>());
+    }
+
+    template <typename _Type>
+        requires(__is_trivially_copyable(_Type))
+    void add_value(const _Type& f_value) noexcept {
+        add(hash_bytes(&f_value, sizeof(_Type)));
+    }
+
+    template <typename _Type>
+        requires(__is_trivially_copyable(_Type))
+    void add_optional(const std::optional<_Type>& f_value) noexcept {
+        add(f_value.has_value());
+        if (f_value.has_value()) {
+            add_value(f_value.value());
+        }
+    }
+
+    [[nodiscard]] u64 value() const noexcept {
+        return m_hash;
+    }
+
+private:
+    u64 m_hash{CFnvOffsetBasis};
+};
+
+//! Serializes validated loader state into a flat byte buffer
+class SnapshotWriter {
+public:
+    template <typename _Type>
+        requires(__is_trivially_copyable(_Type))
+    void write(const _Type& f_value) {
+        const auto* bytes = reinterpret_cast<const u8*>(&f_value);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(_Type));
+    }
+
+    template <typename _Type>
+        requires(__is_trivially_copyable(_Type))
+    void write_optional(const std::optional<_Type>& f_value) {
+        write<bool>(f_value.has_value());
+        if (f_value.has_value()) {
+            write(f_value.value());
+        }
+    }
+
+    void write_size(u64 f_size) {
+        write<u64>(f_size);
+    }
+
+    //! Length prefixed string
+    void write_string(std::string_view f_string) {
+        write_size(f_string.length());
+        m_buffer.insert(m_buffer.end(), f_string.begin(), f_string.end());
+    }
+
+    [[nodiscard]] const std::vector<u8>& buffer() const noexcept {
+        return m_buffer;
+    }
+
+    [[nodiscard]] std::vector<u8>& buffer() noexcept {
+        return m_buffer;
+    }
+
+private:
+    std::vector<u8> m_buffer;
+};
+
+//! Reads back loader state written by SnapshotWriter, bounds checked
+class SnapshotReader {
+public:
+    SnapshotReader(const u8* f_data, u64 f_size) noexcept
+        : m_cursor(f_data)
+        , m_end(f_data + f_size) { }
+
+    explicit SnapshotReader(std::span<const u8> f_data) noexcept
+        : SnapshotReader(f_data.data(), f_data.size()) { }
+
+    template <typename _Type>
+        requires(__is_trivially_copyable(_Type))
+    [[nodiscard]] _Type read() {
+        ensure(sizeof(_Type));
+        _Type value;
+        std::memcpy(&value, m_cursor, sizeof(_Type));
+        m_cursor += sizeof(_Type);
+        return value;
+    }
+
+    template <typename _Type>
+        requires(__is_trivially_copyable(_Type))
+    [[nodiscard]] std::optional<_Type> read_optional() {
+        if (false == read<bool>()) {
+            return std::nullopt;
+        }
+
+        return read<_Type>();
+    }
+
+    [[nodiscard]] u64 read_size() {
+        return read<u64>();
+    }
+
+    //! The returned view points into the snapshot buffer
+    [[nodiscard]] std::string_view read_string() {
+        const auto length = read_size();
+        ensure(length);
+        const std::string_view result{reinterpret_cast<const char*>(m_cursor), length};
+        m_cursor += length;
+        return result;
+    }
+
+    [[nodiscard]] bool at_end() const noexcept {
+        return m_cursor == m_end;
+    }
+
+private:
+    void ensure(u64 f_size) const {
+        if (static_cast<u64>(m_end - m_cursor) < f_size) {
+            throw std::runtime_error("Config snapshot is truncated!");
+        }
+    }
+
+private:
+    const u8* m_cursor;
+    const u8* m_end;
+};
+
+//! Header of a binary config snapshot image, followed by the payload
+struct snapshot_header_t {
+    static constexpr u32 CMagic   = 0x534c4b53U; // "SKLS"
+    static constexpr u32 CVersion = 1U;
+
+    u32 m_magic{CMagic};
+    u32 m_version{CVersion};
+    u64 m_schema_fingerprint{0ULL};
+    u64 m_payload_size{0ULL};
+    u64 m_payload_hash{0ULL};
+};
+
+//! Build a snapshot image (header + payload) for the given schema
+[[nodiscard]] inline std::vector<u8> make_snapshot_image(u64 f_schema_fingerprint, std::span<const u8> f_payload) {
+    const snapshot_header_t header{
+        .m_schema_fingerprint = f_schema_fingerprint,
+        .m_payload_size       = f_payload.size(),
+        .m_payload_hash       = hash_bytes(f_payload.data(), f_payload.size())};
+
+    std::vector<u8> image{};
+    image.resize(sizeof(header) + f_payload.size());
+    std::memcpy(image.data(), &header, sizeof(header));
+    if (false == f_payload.empty()) {
+        std::memcpy(image.data() + sizeof(header), f_payload.data(), f_payload.size());
+    }
+
+    return image;
+}
+
+//! Check the header of a snapshot image and get its payload
+//! \returns std::nullopt if the image is not a valid snapshot of the given schema
+[[nodiscard]] inline std::optional<std::span<const u8>> open_snapshot_image(std::span<const u8> f_image, u64 f_schema_fingerprint) noexcept {
+    snapshot_header_t header{};
+    if (f_image.size() < sizeof(header)) {
+        return std::nullopt;
+    }
+
+    std::memcpy(&header, f_image.data(), sizeof(header));
+    if ((snapshot_header_t::CMagic != header.m_magic)
+        || (snapshot_header_t::CVersion != header.m_version)
+        || (f_schema_fingerprint != header.m_schema_fingerprint)
+        || (header.m_payload_size != (f_image.size() - sizeof(header)))) {
+        return std::nullopt;
+    }
+
+    const auto payload = f_image.subspan(sizeof(header));
+    if (header.m_payload_hash != hash_bytes(payload.data(), payload.size())) {
+        return std::nullopt;
+    }
+
+    return payload;
+}
+} // namespace skl::config
@@ -0,0 +1,234 @@
+//!
+//! \file source_file
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <skl_log>
+#include <skl_string_view>
+
+#include "skl_config_internal/common.hpp"
+
+#define SKL_LOG_TAG ""
+
+namespace skl::config {
+//! Identity of a config file on disk
+struct file_identity_t {
+    u64 m_device{0ULL};
+    u64 m_inode{0ULL};
+    i64 m_mtime_ns{0LL};
+    u64 m_size{0ULL};
+};
+
+//! Read the whole config file into memory
+//! \param f_out_identity Optional, receives the identity of the file that was read
+[[nodiscard]] inline std::string read_config_file(skl_string_view f_file, file_identity_t* f_out_identity = nullptr) {
+    if (false == std::filesystem::exists(f_file.std<std::string_view>())) {
+        SERROR_LOCAL_T("File \"{}\" does not exist!", f_file);
+        throw std::runtime_error("File doesn't exists");
+    }
+
+    if (false == std::filesystem::is_regular_file(f_file.std<std::string_view>())) {
+        SERROR_LOCAL_T("File \"{}\" must be a json file!", f_file);
+        throw std::runtime_error("Invalid json file");
+    }
+
+    std::string file_name{};
+    file_name += f_file.std<std::string_view>();
+
+    const int fd = ::open(file_name.c_str(), O_RDONLY | O_CLOEXEC);
+    if (-1 == fd) {
+        SERROR_LOCAL_T("Failed to open \"{}\" file!", f_file);
+        throw std::runtime_error("File open failed");
+    }
+
+    struct stat info{};
+    if (0 != ::fstat(fd, &info)) {
+        (void)::close(fd);
+        SERROR_LOCAL_T("Failed to stat \"{}\" file!", f_file);
+        throw std::runtime_error("File open failed");
+    }
+
+    std::string result;
+    result.resize(static_cast<u64>(info.st_size));
+
+    u64 offset = 0ULL;
+    while (offset < result.size()) {
+        const auto read = ::read(fd, result.data() + offset, result.size() - offset);
+        if ((read < 0) && (EINTR == errno)) {
+            continue;
+        }
+
+        if (read < 0) {
+            (void)::close(fd);
+            SERROR_LOCAL_T("Failed to read \"{}\" file!", f_file);
+            throw std::runtime_error("File read failed");
+        }
+
+        if (0 == read) {
+            // File shrunk while reading
+            result.resize(offset);
+            break;
+        }
+
+        offset += static_cast<u64>(read);
+    }
+
+    (void)::close(fd);
+
+    if (nullptr != f_out_identity) {
+        f_out_identity->m_device   = static_cast<u64>(info.st_dev);
+        f_out_identity->m_inode    = static_cast<u64>(info.st_ino);
+        f_out_identity->m_mtime_ns = (static_cast<i64>(info.st_mtim.tv_sec) * 1'000'000'000LL) + static_cast<i64>(info.st_mtim.tv_nsec);
+        f_out_identity->m_size     = result.size();
+    }
+
+    return result;
+}
+
+//! Hint the kernel to start reading the file into the page cache, returns immediately (best effort)
+inline void prefetch_config_file(const std::string& f_file) noexcept {
+    const int fd = ::open(f_file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (-1 != fd) {
+        (void)::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        (void)::close(fd);
+    }
+}
+
+//! Read-only memory mapping of a whole file
+class MappedFile {
+public:
+    MappedFile() noexcept = default;
+    ~MappedFile() noexcept {
+        unmap();
+    }
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& f_other) noexcept
+        : m_data(std::exchange(f_other.m_data, nullptr))
+        , m_size(std::exchange(f_other.m_size, 0ULL)) { }
+
+    MappedFile& operator=(MappedFile&& f_other) noexcept {
+        if (this != &f_other) {
+            unmap();
+            m_data = std::exchange(f_other.m_data, nullptr);
+            m_size = std::exchange(f_other.m_size, 0ULL);
+        }
+        return *this;
+    }
+
+    //! Map the given file, throws on failure
+    [[nodiscard]] static MappedFile open(skl_string_view f_file) {
+        std::string file_name{};
+        file_name += f_file.std<std::string_view>();
+
+        const int fd = ::open(file_name.c_str(), O_RDONLY | O_CLOEXEC);
+        if (-1 == fd) {
+            SERROR_LOCAL_T("Failed to open \"{}\" file!", f_file);
+            throw std::runtime_error("File open failed");
+        }
+
+        struct stat info{};
+        if ((0 != ::fstat(fd, &info)) || (false == S_ISREG(info.st_mode))) {
+            (void)::close(fd);
+            SERROR_LOCAL_T("File \"{}\" must be a regular file!", f_file);
+            throw std::runtime_error("File open failed");
+        }
+
+        MappedFile result{};
+        if (0 < info.st_size) {
+            void* data = ::mmap(nullptr, static_cast<u64>(info.st_size), PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+            if (MAP_FAILED == data) {
+                (void)::close(fd);
+                SERROR_LOCAL_T("Failed to map \"{}\" file!", f_file);
+                throw std::runtime_error("File map failed");
+            }
+
+            result.m_data = static_cast<const u8*>(data);
+            result.m_size = static_cast<u64>(info.st_size);
+        }
+
+        (void)::close(fd);
+
+        return result;
+    }
+
+    [[nodiscard]] std::span<const u8> bytes() const noexcept {
+        return {m_data, m_size};
+    }
+
+private:
+    void unmap() noexcept {
+        if (nullptr != m_data) {
+            (void)::munmap(const_cast<u8*>(m_data), m_size);
+            m_data = nullptr;
+            m_size = 0ULL;
+        }
+    }
+
+private:
+    const u8* m_data{nullptr};
+    u64       m_size{0ULL};
+};
+
+//! Process wide id of a temporary file, concurrent writers of the same file (same pid) never share a temp file
+[[nodiscard]] inline u64 next_temp_file_id() noexcept {
+    static std::atomic<u64> next_id{0ULL};
+    return next_id.fetch_add(1ULL, std::memory_order_relaxed);
+}
+
+//! Write \p f_bytes to \p f_file atomically (temp file + rename), throws on failure
+inline void write_file_atomic(skl_string_view f_file, std::span<const u8> f_bytes) {
+    std::string file_name{};
+    file_name += f_file.std<std::string_view>();
+    const auto temp_name = file_name + ".tmp." + std::to_string(::getpid()) + "." + std::to_string(next_temp_file_id());
+
+    const int fd = ::open(temp_name.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (-1 == fd) {
+        SERROR_LOCAL_T("Failed to create \"{}\" file!", f_file);
+        throw std::runtime_error("File open failed");
+    }
+
+    u64 offset = 0ULL;
+    while (offset < f_bytes.size()) {
+        const auto written = ::write(fd, f_bytes.data() + offset, f_bytes.size() - offset);
+        if ((written < 0) && (EINTR == errno)) {
+            continue;
+        }
+
+        if (written <= 0) {
+            (void)::close(fd);
+            (void)::unlink(temp_name.c_str());
+            SERROR_LOCAL_T("Failed to write \"{}\" file!", f_file);
+            throw std::runtime_error("File write failed");
+        }
+
+        offset += static_cast<u64>(written);
+    }
+
+    (void)::close(fd);
+
+    if (0 != ::rename(temp_name.c_str(), file_name.c_str())) {
+        (void)::unlink(temp_name.c_str());
+        SERROR_LOCAL_T("Failed to write \"{}\" file!", f_file);
+        throw std::runtime_error("File write failed");
+    }
+}
+} // namespace skl::config
+
+#undef SKL_LOG_TAG
@@ -0,0 +1,86 @@
+//!
+//! \file source_format
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+#include "skl_config_internal/common.hpp"
+
+namespace skl::config {
+//! Encoding of a config source
+enum class SourceFormat : u8 {
+    Auto,       //!< Detected from the first bytes, see detect_source_format()
+    Json,       //!< Json text (comments allowed)
+    Cbor,       //!< RFC 8949
+    MessagePack,
+    Bson
+};
+
+//! Format of the given source, the root must be an object (map/document)
+//! \remark Bson: the little endian size prefix equals the source size and the document ends with 0x00
+//! \remark Cbor: a map head (0xA0-0xBB, 0xBF) or the self-describe tag (0xD9 0xD9 0xF7)
+//! \remark MessagePack: a map head (0x80-0x8F, 0xDE, 0xDF)
+//! \remark Anything else is json text
+[[nodiscard]] constexpr SourceFormat detect_source_format(std::string_view f_source) noexcept {
+    if (f_source.empty()) {
+        return SourceFormat::Json;
+    }
+
+    if ((f_source.size() >= 5U) && (0 == f_source.back())) {
+        const u64 size = static_cast<u64>(static_cast<u8>(f_source[0]))
+                       | (static_cast<u64>(static_cast<u8>(f_source[1])) << 8U)
+                       | (static_cast<u64>(static_cast<u8>(f_source[2])) << 16U)
+                       | (static_cast<u64>(static_cast<u8>(f_source[3])) << 24U);
+        if (size == f_source.size()) {
+            return SourceFormat::Bson;
+        }
+    }
+
+    const auto first = static_cast<u8>(f_source[0]);
+    if (((first >= 0xA0U) && (first <= 0xBBU)) || (0xBFU == first)) {
+        return SourceFormat::Cbor;
+    }
+
+    if ((f_source.size() >= 3U) && (0xD9U == first) && (0xD9U == static_cast<u8>(f_source[1])) && (0xF7U == static_cast<u8>(f_source[2]))) {
+        return SourceFormat::Cbor;
+    }
+
+    if (((first >= 0x80U) && (first <= 0x8FU)) || (0xDEU == first) || (0xDFU == first)) {
+        return SourceFormat::MessagePack;
+    }
+
+    return SourceFormat::Json;
+}
+
+//! Parse the source in the given format (detected if Auto)
+//! \remark Throws the nlohmann parse errors, same as for json text
+//! \remark f_callback is only used for json text (eg. make_length_limit_callback())
+[[nodiscard]] inline nlohmann::json parse_source(std::string_view                         f_source,
+                                                 SourceFormat                             f_format   = SourceFormat::Auto,
+                                                 const nlohmann::json::parser_callback_t& f_callback = nullptr) {
+    if (SourceFormat::Auto == f_format) {
+        f_format = detect_source_format(f_source);
+    }
+
+    switch (f_format) {
+        case SourceFormat::Cbor:
+            return nlohmann::json::from_cbor(f_source.begin(), f_source.end());
+        case SourceFormat::MessagePack:
+            return nlohmann::json::from_msgpack(f_source.begin(), f_source.end());
+        case SourceFormat::Bson:
+            return nlohmann::json::from_bson(f_source.begin(), f_source.end());
+        case SourceFormat::Auto:
+        case SourceFormat::Json:
+        default:
+            return nlohmann::json::parse(f_source,
+                /* callback */ f_callback,
+                /* allow_exceptions */ true,
+                /* ignore_comments */ true);
+    }
+}
+} // namespace skl::config
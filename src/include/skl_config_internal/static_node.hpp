@@ -0,0 +1,615 @@
+//!
+//! \file static_node
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <skl_log>
+#include <skl_string_view>
+
+#include "skl_config_internal/numeric_field.hpp"
+#include "skl_config_internal/string_field.hpp"
+#include "skl_config_internal/enum_table.hpp"
+#include "skl_config_internal/diagnostics.hpp"
+#include "skl_config_internal/source_file.hpp"
+#include "skl_config_internal/source_format.hpp"
+
+#define SKL_LOG_TAG ""
+
+namespace skl::config {
+//! Compile time name of a static field, usable as a template argument (eg. schema::field<"port", ...>)
+template <u64 _N>
+struct static_name_t {
+    consteval static_name_t(const char (&f_name)[_N]) noexcept {
+        std::copy_n(f_name, _N, m_value);
+    }
+
+    [[nodiscard]] constexpr std::string_view view() const noexcept {
+        return std::string_view{m_value, _N - 1U};
+    }
+
+    char m_value[_N];
+};
+
+//! Path of a static field, only formatted when an error is reported
+struct static_path_t {
+    static constexpr u64 CNoIndex = ~0ULL;
+
+    const static_path_t* m_parent{nullptr};
+    std::string_view     m_name{};
+    u64                  m_index{CNoIndex}; //!< Array element index, the name is then unused
+
+    [[nodiscard]] std::string str() const {
+        std::string result = (nullptr == m_parent) ? std::string{} : m_parent->str();
+        if (CNoIndex != m_index) {
+            result += '[';
+            result += std::to_string(m_index);
+            result += ']';
+            return result;
+        }
+
+        if (false == result.empty()) {
+            result += ':';
+        }
+
+        result += m_name;
+        return result;
+    }
+};
+
+//! Options of the static fields
+namespace schema {
+    //! The member must be present in the json
+    struct required { };
+
+    //! Value used when the (numeric, boolean or enum) member is absent
+    template <auto _Value>
+    struct default_value { };
+
+    //! Value used when the string member is absent
+    template <static_name_t _Value>
+    struct default_string { };
+
+    //! Inclusive lower bound of the value (numeric members) or of the length (strings and arrays)
+    template <auto _Min>
+    struct min { };
+
+    //! Inclusive upper bound of the value (numeric members) or of the length (strings and arrays)
+    template <auto _Max>
+    struct max { };
+
+    //! Custom check, called as _Constraint{}(value) -> bool (char[N] members pass a std::string_view)
+    template <typename _Constraint>
+    struct constraint { };
+} // namespace schema
+
+namespace static_detail {
+    template <typename _MemberPtr>
+    struct member_traits_t;
+
+    template <typename _Type, typename _Object>
+    struct member_traits_t<_Type _Object::*> {
+        using object_t = _Object;
+        using value_t  = _Type;
+    };
+
+    template <typename... _Options>
+    struct default_of_t {
+        static constexpr bool CHas = false;
+    };
+
+    template <auto _Value, typename... _Rest>
+    struct default_of_t<schema::default_value<_Value>, _Rest...> {
+        static constexpr bool CHas   = true;
+        static constexpr auto CValue = _Value;
+    };
+
+    template <static_name_t _Value, typename... _Rest>
+    struct default_of_t<schema::default_string<_Value>, _Rest...> {
+        static constexpr bool             CHas   = true;
+        static constexpr std::string_view CValue = _Value.view();
+    };
+
+    template <typename _First, typename... _Rest>
+    struct default_of_t<_First, _Rest...> : default_of_t<_Rest...> { };
+
+    template <typename... _Options>
+    struct min_of_t {
+        static constexpr bool CHas   = false;
+        static constexpr u64  CValue = 0ULL;
+    };
+
+    template <auto _Min, typename... _Rest>
+    struct min_of_t<schema::min<_Min>, _Rest...> {
+        static constexpr bool CHas   = true;
+        static constexpr auto CValue = _Min;
+    };
+
+    template <typename _First, typename... _Rest>
+    struct min_of_t<_First, _Rest...> : min_of_t<_Rest...> { };
+
+    template <typename... _Options>
+    struct max_of_t {
+        static constexpr bool CHas   = false;
+        static constexpr u64  CValue = ~0ULL;
+    };
+
+    template <auto _Max, typename... _Rest>
+    struct max_of_t<schema::max<_Max>, _Rest...> {
+        static constexpr bool CHas   = true;
+        static constexpr auto CValue = _Max;
+    };
+
+    template <typename _First, typename... _Rest>
+    struct max_of_t<_First, _Rest...> : max_of_t<_Rest...> { };
+
+    template <typename _Option>
+    struct constraint_of_t {
+        template <typename _Value>
+        [[nodiscard]] static constexpr bool check(const _Value&) noexcept {
+            return true;
+        }
+    };
+
+    template <typename _Constraint>
+    struct constraint_of_t<schema::constraint<_Constraint>> {
+        template <typename _Value>
+        [[nodiscard]] static bool check(const _Value& f_value) {
+            return _Constraint{}(f_value);
+        }
+    };
+
+    template <typename _Type>
+    concept CStaticScalarType = __is_same(_Type, bool)
+                             || CNumericValueFieldType<_Type>
+                             || CEnumValueFieldType<_Type>
+                             || __is_same(_Type, std::string)
+                             || is_string_buffer<_Type>::value;
+
+    template <typename _Type>
+    concept CStaticArrayType = CNormalContainerType<_Type>
+                            && (false == __is_same(_Type, std::string))
+                            && CStaticScalarType<typename _Type::value_type>
+                            && (false == is_string_buffer<typename _Type::value_type>::value);
+
+    //! Loaded value of a member, char[N] values are kept inline
+    template <typename _Type>
+    struct staged_t {
+        using type = _Type;
+    };
+
+    template <u64 _N>
+    struct staged_t<char[_N]> {
+        using type = FixedStringValue<_N>;
+    };
+
+    //! Decode a scalar value as the runtime fields do by default (numbers from numeric strings too, enums by name)
+    template <CStaticScalarType _Type>
+    [[nodiscard]] typename staged_t<_Type>::type decode_scalar(const json& f_json, const static_path_t& f_path) {
+        if constexpr (__is_same(_Type, bool)) {
+            if (false == f_json.is_boolean()) {
+                SERROR_LOCAL_T("Boolean field \"{}\"'s value cannot be interpreted as boolean!", f_path.str().c_str());
+                throw std::runtime_error("Boolean field's value cannot be interpreted as boolean!");
+            }
+
+            return f_json.template get<bool>();
+        } else if constexpr (CNumericValueFieldType<_Type>) {
+            const auto result = decode_numeric<_Type>(f_json);
+            if (false == result.has_value()) {
+                SERROR_LOCAL_T("Numeric field \"{}\" has an invalid value({})! Min[{}] Max[{}]",
+                               f_path.str().c_str(),
+                               f_json.dump().c_str(),
+                               std::numeric_limits<_Type>::min(),
+                               std::numeric_limits<_Type>::max());
+                throw std::runtime_error("Invalid numeric field value!");
+            }
+
+            return result.value();
+        } else if constexpr (CEnumValueFieldType<_Type>) {
+            if (false == f_json.is_string()) {
+                SERROR_LOCAL_T("Enum field \"{}\" must have a string value!", f_path.str().c_str());
+                throw std::runtime_error("Enum field not a string!");
+            }
+
+            const auto result = EnumTable<_Type>::find(json_string_view(f_json));
+            if (false == result.has_value()) {
+                SERROR_LOCAL_T("Enum field \"{}\" has invalid value({})!", f_path.str().c_str(), f_json.dump().c_str());
+                throw std::runtime_error("Invalid enum field value!");
+            }
+
+            return result.value();
+        } else {
+            if (false == f_json.is_string()) {
+                SERROR_LOCAL_T("Field \"{}\" must be a string field!", f_path.str().c_str());
+                throw std::runtime_error("String field doesnt have a string value!");
+            }
+
+            const auto value = json_string_view(f_json);
+            if constexpr (is_string_buffer<_Type>::value) {
+                if ((sizeof(_Type) - 1U) < value.length()) {
+                    SERROR_LOCAL_T("StringField<char[{}]> \"{}\" value read overruns the target buffer!\n\tvalue->\"{}\"", sizeof(_Type), f_path.str().c_str(), skl_string_view::from_std(value));
+                    throw std::runtime_error("StringField<char[N]> value read overruns the target buffer!");
+                }
+
+                return FixedStringValue<sizeof(_Type)>{value};
+            } else {
+                return std::string{value};
+            }
+        }
+    }
+
+    //! Check the min/max options, on the value of numeric members and on the length of strings and arrays
+    template <typename _Min, typename _Max, typename _Value>
+    [[nodiscard]] constexpr bool check_bounds(const _Value& f_value) noexcept {
+        if constexpr (CNumericValueFieldType<_Value>) {
+            if constexpr (_Min::CHas) {
+                if (f_value < static_cast<_Value>(_Min::CValue)) {
+                    return false;
+                }
+            }
+
+            if constexpr (_Max::CHas) {
+                if (f_value > static_cast<_Value>(_Max::CValue)) {
+                    return false;
+                }
+            }
+
+            return true;
+        } else if constexpr (requires { f_value.length(); }) {
+            return ((false == _Min::CHas) || (static_cast<u64>(f_value.length()) >= static_cast<u64>(_Min::CValue)))
+                && ((false == _Max::CHas) || (static_cast<u64>(f_value.length()) <= static_cast<u64>(_Max::CValue)));
+        } else if constexpr (requires { f_value.size(); }) {
+            return ((false == _Min::CHas) || (static_cast<u64>(f_value.size()) >= static_cast<u64>(_Min::CValue)))
+                && ((false == _Max::CHas) || (static_cast<u64>(f_value.size()) <= static_cast<u64>(_Max::CValue)));
+        } else {
+            static_assert((false == _Min::CHas) && (false == _Max::CHas), "min/max only apply to numeric, string and array members");
+            return true;
+        }
+    }
+
+    //! Numeric defaults are checked against min/max at compile time
+    template <typename _Type, typename _Default, typename _Min, typename _Max>
+    [[nodiscard]] consteval bool default_in_bounds() noexcept {
+        if constexpr (_Default::CHas && CNumericValueFieldType<_Type>) {
+            return check_bounds<_Min, _Max>(static_cast<_Type>(_Default::CValue));
+        } else {
+            return true;
+        }
+    }
+} // namespace static_detail
+
+namespace schema {
+    //! Scalar (numeric, bool, enum, std::string, char[N]) or array of scalars member
+    //! \remark Absent non required arrays are loaded empty, absent non required scalars need a default value
+    template <static_name_t _Name, auto _MemberPtr, typename... _Options>
+    struct field {
+        using traits_t = static_detail::member_traits_t<decltype(_MemberPtr)>;
+        using target_t = typename traits_t::object_t;
+        using member_t = typename traits_t::value_t;
+        using value_t  = typename static_detail::staged_t<member_t>::type;
+
+        using default_t = static_detail::default_of_t<_Options...>;
+        using min_t     = static_detail::min_of_t<_Options...>;
+        using max_t     = static_detail::max_of_t<_Options...>;
+
+        static constexpr std::string_view CName     = _Name.view();
+        static constexpr bool             CRequired = (__is_same(_Options, required) || ...);
+        static constexpr bool             CIsArray  = static_detail::CStaticArrayType<member_t>;
+
+        static_assert(CIsArray || static_detail::CStaticScalarType<member_t>, "Unsupported static field member type");
+        static_assert(CRequired || CIsArray || default_t::CHas, "A non required static field needs a default value");
+        static_assert((false == default_t::CHas) || (false == CIsArray), "Static array fields default to empty");
+        static_assert(static_detail::default_in_bounds<member_t, default_t, min_t, max_t>(), "The default value of the static field is out of its min/max bounds");
+
+        struct state_t {
+            std::optional<value_t> m_value;
+            bool                   m_is_default{false};
+        };
+
+        static void load(state_t& f_state, const json& f_json, const static_path_t* f_parent) {
+            const auto it = f_json.find(CName);
+            if (f_json.end() != it) {
+                const static_path_t path{f_parent, CName};
+                if constexpr (CIsArray) {
+                    if (false == it->is_array()) {
+                        SERROR_LOCAL_T("Field \"{}\" must be an array!\n\tjson: {}", path.str().c_str(), it->dump().c_str());
+                        throw std::runtime_error("Wrong field type!");
+                    }
+
+                    auto& values = f_state.m_value.emplace();
+                    if constexpr (requires { values.reserve(it->size()); }) {
+                        values.reserve(it->size());
+                    }
+
+                    for (u64 i = 0ULL; i < it->size(); ++i) {
+                        values.push_back(static_detail::decode_scalar<typename member_t::value_type>((*it)[i], static_path_t{&path, {}, i}));
+                    }
+                } else {
+                    f_state.m_value.emplace(static_detail::decode_scalar<member_t>(*it, path));
+                }
+
+                f_state.m_is_default = false;
+                return;
+            }
+
+            if constexpr (CRequired) {
+                SERROR_LOCAL_T("Field \"{}\" is required!", static_path_t{f_parent, CName}.str().c_str());
+                throw std::runtime_error("Missing required field!");
+            } else {
+                if constexpr (CIsArray) {
+                    f_state.m_value.emplace();
+                } else {
+                    f_state.m_value.emplace(default_t::CValue);
+                }
+
+                f_state.m_is_default = true;
+            }
+        }
+
+        static void validate(state_t& f_state, const static_path_t* f_parent) {
+            SKL_ASSERT(f_state.m_value.has_value());
+
+            const auto& value = f_state.m_value.value();
+            if constexpr (is_string_buffer<member_t>::value) {
+                if (static_detail::check_bounds<min_t, max_t>(value) && (static_detail::constraint_of_t<_Options>::check(value.view()) && ...)) {
+                    return;
+                }
+            } else {
+                if (static_detail::check_bounds<min_t, max_t>(value) && (static_detail::constraint_of_t<_Options>::check(value) && ...)) {
+                    return;
+                }
+            }
+
+            if (f_state.m_is_default) {
+                SERROR_LOCAL_T("Invalid default value for field \"{}\"!", static_path_t{f_parent, CName}.str().c_str());
+                throw std::runtime_error("Static field invalid default value");
+            }
+
+            SERROR_LOCAL_T("Invalid value for field \"{}\"!", static_path_t{f_parent, CName}.str().c_str());
+            throw std::runtime_error("Static field invalid value");
+        }
+
+        static void submit(state_t& f_state, target_t& f_config) {
+            SKL_ASSERT(f_state.m_value.has_value());
+
+            if constexpr (is_string_buffer<member_t>::value) {
+                const auto value  = f_state.m_value->view();
+                const auto length = value.copy(f_config.*_MemberPtr, sizeof(member_t) - 1U);
+
+                (f_config.*_MemberPtr)[length] = 0;
+            } else {
+                f_config.*_MemberPtr = std::move(f_state.m_value.value());
+            }
+        }
+    };
+
+    //! Nested object member, loaded through the static node _Node
+    //! \remark Absent non required objects are loaded from an empty object (all the members take their default value)
+    template <static_name_t _Name, auto _MemberPtr, typename _Node, typename... _Options>
+    struct object {
+        using traits_t = static_detail::member_traits_t<decltype(_MemberPtr)>;
+        using target_t = typename traits_t::object_t;
+
+        static constexpr std::string_view CName     = _Name.view();
+        static constexpr bool             CRequired = (__is_same(_Options, required) || ...);
+
+        static_assert(__is_same(typename traits_t::value_t, typename _Node::target_t), "The static node must load the member's type");
+
+        using state_t = _Node;
+
+        static void load(state_t& f_state, const json& f_json, const static_path_t* f_parent) {
+            const static_path_t path{f_parent, CName};
+
+            const auto it = f_json.find(CName);
+            if (f_json.end() != it) {
+                if (false == it->is_object()) {
+                    SERROR_LOCAL_T("Field \"{}\" must be an object!\n\tjson: {}", path.str().c_str(), it->dump().c_str());
+                    throw std::runtime_error("Wrong field type!");
+                }
+
+                f_state.load(*it, &path);
+                return;
+            }
+
+            if constexpr (CRequired) {
+                SERROR_LOCAL_T("Object field \"{}\" is required!", path.str().c_str());
+                throw std::runtime_error("Missing required object field!");
+            } else {
+                static const json CEmpty = json::object();
+                f_state.load(CEmpty, &path);
+            }
+        }
+
+        static void validate(state_t& f_state, const static_path_t* f_parent) {
+            const static_path_t path{f_parent, CName};
+            f_state.validate(&path);
+        }
+
+        static void submit(state_t& f_state, target_t& f_config) {
+            f_state.submit(f_config.*_MemberPtr);
+        }
+    };
+
+    //! Array of objects member, each element loaded through the static node _Node
+    //! \remark min/max bound the elements count, absent non required arrays are loaded empty
+    template <static_name_t _Name, auto _MemberPtr, typename _Node, typename... _Options>
+    struct array {
+        using traits_t    = static_detail::member_traits_t<decltype(_MemberPtr)>;
+        using target_t    = typename traits_t::object_t;
+        using container_t = typename traits_t::value_t;
+
+        using min_t = static_detail::min_of_t<_Options...>;
+        using max_t = static_detail::max_of_t<_Options...>;
+
+        static constexpr std::string_view CName     = _Name.view();
+        static constexpr bool             CRequired = (__is_same(_Options, required) || ...);
+
+        static_assert(CNormalContainerType<container_t>, "Static array members must be resizable containers");
+        static_assert(__is_same(typename container_t::value_type, typename _Node::target_t), "The static node must load the array's element type");
+
+        using state_t = std::vector<_Node>;
+
+        static void load(state_t& f_state, const json& f_json, const static_path_t* f_parent) {
+            const static_path_t path{f_parent, CName};
+
+            f_state.clear();
+
+            const auto it = f_json.find(CName);
+            if (f_json.end() != it) {
+                if (false == it->is_array()) {
+                    SERROR_LOCAL_T("Field \"{}\" must be an array!\n\tjson: {}", path.str().c_str(), it->dump().c_str());
+                    throw std::runtime_error("Wrong field type!");
+                }
+
+                f_state.resize(it->size());
+                for (u64 i = 0ULL; i < f_state.size(); ++i) {
+                    const static_path_t element{&path, {}, i};
+                    f_state[i].load((*it)[i], &element);
+                }
+                return;
+            }
+
+            if constexpr (CRequired) {
+                SERROR_LOCAL_T("Array field \"{}\" is required!", path.str().c_str());
+                throw std::runtime_error("Missing required array field!");
+            }
+        }
+
+        static void validate(state_t& f_state, const static_path_t* f_parent) {
+            const static_path_t path{f_parent, CName};
+
+            if (false == static_detail::check_bounds<min_t, max_t>(f_state)) {
+                SERROR_LOCAL_T("Array field \"{}\" elements count must be in [min={}, max={}]!", path.str().c_str(), static_cast<u64>(min_t::CValue), static_cast<u64>(max_t::CValue));
+                throw std::runtime_error("Array field has invalid length!");
+            }
+
+            for (u64 i = 0ULL; i < f_state.size(); ++i) {
+                const static_path_t element{&path, {}, i};
+                f_state[i].validate(&element);
+            }
+        }
+
+        static void submit(state_t& f_state, target_t& f_config) {
+            auto& container = f_config.*_MemberPtr;
+            container.clear();
+            if constexpr (requires { container.reserve(f_state.size()); }) {
+                container.reserve(f_state.size());
+            }
+
+            for (auto& entry : f_state) {
+                container.emplace_back();
+                entry.submit(container.back());
+            }
+        }
+    };
+} // namespace schema
+} // namespace skl::config
+
+namespace skl {
+//! Config node whose schema is fixed at compile time by a list of field descriptors (config::schema::field, object and array)
+//! \remark Same load, validate and submit phases as ConfigNode (errors are reported for all the fields, the target is
+//!         only written once everything validated), without heap allocated fields or virtual dispatch
+//! \remark Default-constructible and stateless between loads, a schema needs no registration code
+template <config::CConfigTargetType _TargetConfig, typename... _Fields>
+    requires((__is_same(typename _Fields::target_t, _TargetConfig)) && ...)
+class StaticConfigNode {
+public:
+    using target_t = _TargetConfig;
+
+    static constexpr u64 CFieldCount = sizeof...(_Fields);
+
+    //! Load + validate + submit (json text, cbor, msgpack or bson, detected from the first bytes)
+    void load_validate_and_submit(skl_string_view f_file, _TargetConfig& f_out_config) {
+        const auto source = config::read_config_file(f_file);
+        load_validate_and_submit_json(config::parse_source(source), f_out_config);
+    }
+
+    //! Load + validate + submit from an in-memory source (json text, cbor, msgpack or bson)
+    void load_validate_and_submit_buffer(std::span<const u8> f_source, _TargetConfig& f_out_config) {
+        load_validate_and_submit_json(config::parse_source(std::string_view{reinterpret_cast<const char*>(f_source.data()), f_source.size()}), f_out_config);
+    }
+
+    //! Load + validate + submit from an already parsed document
+    void load_validate_and_submit_json(const config::json& f_json, _TargetConfig& f_out_config) {
+        load(f_json, nullptr);
+        validate(nullptr);
+        submit(f_out_config);
+    }
+
+    //! Load phase, f_path is the path of this node (nullptr for a root)
+    void load(const config::json& f_json, const config::static_path_t* f_path) {
+        const bool succeeded = for_each_field([&f_json, f_path](auto f_field, auto& f_state) {
+            decltype(f_field)::load(f_state, f_json, f_path);
+        });
+
+        if (false == succeeded) {
+            throw std::runtime_error("Load failed for config!");
+        }
+    }
+
+    //! Validate phase, after load()
+    void validate(const config::static_path_t* f_path) {
+        const bool succeeded = for_each_field([f_path](auto f_field, auto& f_state) {
+            decltype(f_field)::validate(f_state, f_path);
+        });
+
+        if (false == succeeded) {
+            throw std::runtime_error("Validaton failed for config!");
+        }
+    }
+
+    //! Submit phase, after validate()
+    void submit(_TargetConfig& f_out_config) {
+        submit_fields(f_out_config, std::index_sequence_for<_Fields...>{});
+    }
+
+private:
+    //! Run f_op on all fields, errors are printed in field order
+    //! \returns false if any field failed
+    template <typename _Op>
+    [[nodiscard]] bool for_each_field(_Op&& f_op) {
+        return for_each_field(f_op, std::index_sequence_for<_Fields...>{});
+    }
+
+    template <typename _Op, u64... _Indices>
+    [[nodiscard]] bool for_each_field(_Op& f_op, std::index_sequence<_Indices...>) {
+        bool succeeded = true;
+        ((succeeded = run_field<std::tuple_element_t<_Indices, std::tuple<_Fields...>>>(f_op, std::get<_Indices>(m_states)) && succeeded), ...);
+        return succeeded;
+    }
+
+    template <typename _Field, typename _Op>
+    [[nodiscard]] static bool run_field(_Op& f_op, typename _Field::state_t& f_state) noexcept {
+        try {
+            f_op(_Field{}, f_state);
+            return true;
+        } catch (const std::exception& f_ex) {
+            config::report_error(f_ex.what());
+        } catch (...) {
+            config::report_error("Unknown error!");
+        }
+
+        return false;
+    }
+
+    template <u64... _Indices>
+    void submit_fields(_TargetConfig& f_out_config, std::index_sequence<_Indices...>) {
+        (std::tuple_element_t<_Indices, std::tuple<_Fields...>>::submit(std::get<_Indices>(m_states), f_out_config), ...);
+    }
+
+private:
+    std::tuple<typename _Fields::state_t...> m_states;
+};
+} // namespace skl
+
+#undef SKL_LOG_TAG
@@ -0,0 +1,135 @@
+//!
+//! \file string_arena
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "skl_config_internal/common.hpp"
+
+namespace skl::config {
+//! Interned, deduplicated strings, stored in large blocks owned by the arena
+//! \remark Views returned by intern() stay valid until the arena is cleared or destroyed
+//! \remark Thread safe, staged array elements may be interned from the executor's workers
+class StringArena {
+public:
+    static constexpr u64 CDefaultBlockSize = 64ULL * 1024ULL;
+
+    explicit StringArena(u64 f_block_size = CDefaultBlockSize) noexcept
+        : m_block_size(std::max<u64>(f_block_size, 64ULL))
+        , m_block_offset(m_block_size) { }
+
+    ~StringArena()                                 = default;
+    StringArena(const StringArena&)                = delete;
+    StringArena& operator=(const StringArena&)     = delete;
+    StringArena(StringArena&&) noexcept            = delete;
+    StringArena& operator=(StringArena&&) noexcept = delete;
+
+    //! View of the arena's copy of f_value, the same view for equal values
+    [[nodiscard]] std::string_view intern(std::string_view f_value) {
+        std::lock_guard lock{m_lock};
+
+        ++m_requests;
+
+        const auto it = m_strings.find(f_value);
+        if (m_strings.end() != it) {
+            return *it;
+        }
+
+        const auto stored = store(f_value);
+        m_strings.insert(stored);
+        return stored;
+    }
+
+    //! Number of distinct strings
+    [[nodiscard]] u64 size() const noexcept {
+        std::lock_guard lock{m_lock};
+        return m_strings.size();
+    }
+
+    //! Number of intern() calls
+    [[nodiscard]] u64 requests() const noexcept {
+        std::lock_guard lock{m_lock};
+        return m_requests;
+    }
+
+    //! Bytes of the distinct strings
+    [[nodiscard]] u64 bytes_used() const noexcept {
+        std::lock_guard lock{m_lock};
+        return m_bytes_used;
+    }
+
+    //! Bytes allocated for the blocks
+    [[nodiscard]] u64 bytes_reserved() const noexcept {
+        std::lock_guard lock{m_lock};
+        return m_bytes_reserved;
+    }
+
+    //! Release all strings
+    //! \remark Invalidates all the views returned so far
+    void clear() noexcept {
+        std::lock_guard lock{m_lock};
+        m_strings.clear();
+        m_blocks.clear();
+        m_open_block     = nullptr;
+        m_block_offset   = m_block_size;
+        m_requests       = 0ULL;
+        m_bytes_used     = 0ULL;
+        m_bytes_reserved = 0ULL;
+    }
+
+private:
+    struct hash_t {
+        using is_transparent = void;
+
+        [[nodiscard]] u64 operator()(std::string_view f_value) const noexcept {
+            return std::hash<std::string_view>{}(f_value);
+        }
+    };
+
+    [[nodiscard]] std::string_view store(std::string_view f_value) {
+        if (f_value.empty()) {
+            return std::string_view{};
+        }
+
+        char* target = nullptr;
+        if (f_value.size() > m_block_size) {
+            // Own block, the open block stays open
+            target = m_blocks.emplace_back(std::make_unique_for_overwrite<char[]>(f_value.size())).get();
+            m_bytes_reserved += f_value.size();
+        } else {
+            if ((m_block_size - m_block_offset) < f_value.size()) {
+                m_open_block   = m_blocks.emplace_back(std::make_unique_for_overwrite<char[]>(m_block_size)).get();
+                m_block_offset = 0ULL;
+                m_bytes_reserved += m_block_size;
+            }
+
+            target = m_open_block + m_block_offset;
+            m_block_offset += f_value.size();
+        }
+
+        std::memcpy(target, f_value.data(), f_value.size());
+        m_bytes_used += f_value.size();
+        return std::string_view{target, f_value.size()};
+    }
+
+private:
+    std::unordered_set<std::string_view, hash_t, std::equal_to<>> m_strings;
+    std::vector<std::unique_ptr<char[]>>                         m_blocks;
+    char*                                                        m_open_block{nullptr}; //!< Block the small strings are appended to
+    u64                                                          m_block_size;
+    u64                                                          m_block_offset;        //!< Used bytes of the open block
+    u64                                                          m_requests{0ULL};
+    u64                                                          m_bytes_used{0ULL};
+    u64                                                          m_bytes_reserved{0ULL};
+    mutable std::mutex                                           m_lock;
+};
+} // namespace skl::config
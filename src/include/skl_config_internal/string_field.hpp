@@ -5,6 +5,9 @@
 //!
 #pragma once
 
+#include <array>
+#include <cstring>
+
 #include <skl_log>
 
 #include "skl_config_internal/field.hpp"
@@ -22,16 +25,82 @@ template <typename _Functor, typename _TargetConfig>
 concept CStringFieldPreSubmitFunctor = __is_class(_Functor)
                                     && std::is_invocable_r_v<bool, _Functor, Field&, std::string&, _TargetConfig&>;
 
+//! Value of a char[N] string field, stored inline so loading it does not allocate
+//! \remark Values longer than the buffer are kept whole on the heap, the field rejects or truncates them on submit
+template <u64 _N>
+class FixedStringValue {
+public:
+    static constexpr u64 CCapacity = _N - 1ULL;
+
+    FixedStringValue() noexcept = default;
+
+    explicit FixedStringValue(std::string_view f_value) {
+        assign(f_value);
+    }
+
+    void assign(std::string_view f_value) {
+        if (f_value.length() > CCapacity) {
+            m_overflow.assign(f_value);
+            return;
+        }
+
+        m_overflow.clear();
+        m_length         = static_cast<u32>(f_value.copy(m_data.data(), CCapacity));
+        m_data[m_length] = 0;
+    }
+
+    [[nodiscard]] std::string_view view() const noexcept {
+        if (false == m_overflow.empty()) {
+            return m_overflow;
+        }
+
+        return std::string_view{m_data.data(), m_length};
+    }
+
+    [[nodiscard]] const char* c_str() const noexcept {
+        if (false == m_overflow.empty()) {
+            return m_overflow.c_str();
+        }
+
+        return m_data.data();
+    }
+
+    [[nodiscard]] u64 length() const noexcept {
+        return view().length();
+    }
+
+    operator std::string_view() const noexcept {
+        return view();
+    }
+
+private:
+    std::array<char, _N> m_data{};
+    u32                  m_length{0U};
+    std::string          m_overflow; //!< Value longer than the buffer (empty otherwise)
+};
+
 template <CStringValueFieldType _Type, CConfigTargetType _TargetConfig, bool _PartOfArray = false>
 class StringField : public ConfigField<_TargetConfig> {
 public:
+    //! Target is a char[N] buffer
+    static constexpr bool CIsBuffer = is_string_buffer<_Type>::value;
+
+    //! Loaded value, char[N] values are kept inline
+    using value_t = std::conditional_t<CIsBuffer, FixedStringValue<sizeof(_Type)>, std::string>;
+
+    //! Value passed to the constraints and the post load handler, a view for char[N] targets
+    using value_arg_t = std::conditional_t<CIsBuffer, std::string_view, const std::string&>;
+
     using member_ptr_t  = _Type _TargetConfig::*;
-    using constraints_t = std::vector<std::function<bool(Field&, const std::string&)>>;
-    using post_load_t   = std::function<bool(Field&, const std::string&)>;
+    using constraints_t = std::vector<std::function<bool(Field&, value_arg_t)>>;
+    using post_load_t   = std::function<bool(Field&, value_arg_t)>;
     using pre_submit_t  = std::function<bool(Field&, std::string&, _TargetConfig&)>;
 
+    //! Target is a std::string_view into the arena set with ConfigNode::intern_strings()
+    static constexpr bool CIsInterned = __is_same(std::string_view, _Type);
+
     StringField(Field* f_parent, std::string_view f_field_name, member_ptr_t f_member_ptr) noexcept
-        requires(__is_same(std::string, _Type))
+        requires(__is_same(std::string, _Type) || __is_same(std::string_view, _Type))
         : ConfigField<_TargetConfig>(f_parent, f_field_name)
         , m_member_ptr(f_member_ptr) {
     }
@@ -57,7 +126,7 @@ public:
     }
 
     StringField& default_value(std::string_view f_default_string) {
-        if constexpr (false == __is_same(std::string, _Type)) {
+        if constexpr (CIsBuffer) {
             if (f_default_string.length() > (m_buffer_size - 1U)) {
                 SERROR_LOCAL_T("[Setup] StringField<char[{}]> default value(\"{}\" length={}) doesn't fit inside the buffer!", m_buffer_size, skl_string_view::from_std(f_default_string), f_default_string.length());
                 throw std::runtime_error("[Setup] StringField<char[N]> default value doesn't fit inside the buffer!");
@@ -70,7 +139,7 @@ public:
     }
 
     StringField& default_value(std::string_view f_default_string, bool f_validate) {
-        if constexpr (false == __is_same(std::string, _Type)) {
+        if constexpr (CIsBuffer) {
             if (f_default_string.length() > (m_buffer_size - 1U)) {
                 SERROR_LOCAL_T("[Setup] StringField<char[{}]> default value(\"{}\" length={}) doesn't fit inside the buffer!", m_buffer_size, skl_string_view::from_std(f_default_string), f_default_string.length());
                 throw std::runtime_error("[Setup] StringField<char[N]> default value doesn't fit inside the buffer!");
@@ -83,7 +152,7 @@ public:
     }
 
     StringField& default_value(std::string&& default_val) {
-        if constexpr (false == __is_same(std::string, _Type)) {
+        if constexpr (CIsBuffer) {
             if (default_val.length() > (m_buffer_size - 1U)) {
                 SERROR_LOCAL_T("[Setup] StringField<char[{}]> default value(\"{}\" length={}) doesn't fit inside the buffer!", m_buffer_size, default_val.c_str(), default_val.length());
                 throw std::runtime_error("[Setup] StringField<char[N]> default value doesn't fit inside the buffer!");
@@ -96,7 +165,7 @@ public:
     }
 
     StringField& default_value(std::string&& default_val, bool f_validate) {
-        if constexpr (false == __is_same(std::string, _Type)) {
+        if constexpr (CIsBuffer) {
             if (default_val.length() > (m_buffer_size - 1U)) {
                 SERROR_LOCAL_T("[Setup] StringField<char[{}]> default value(\"{}\" length={}) doesn't fit inside the buffer!", m_buffer_size, default_val.c_str(), default_val.length());
                 throw std::runtime_error("[Setup] StringField<char[N]> default value doesn't fit inside the buffer!");
@@ -114,7 +183,7 @@ public:
     }
 
     StringField& truncate_to_buffer(bool f_truncate_to_buffer) noexcept
-        requires(false == __is_same(std::string, _Type))
+        requires(CIsBuffer)
     {
         m_truncate_to_buffer = f_truncate_to_buffer;
         return *this;
@@ -127,14 +196,14 @@ public:
     }
 
     StringField& min_length(u32 f_min_length) {
-        if constexpr (false == __is_same(std::string, _Type)) {
+        if constexpr (CIsBuffer) {
             if (f_min_length > (m_buffer_size - 1U)) {
                 SERROR_LOCAL_T("[Setup] StringField<char[{}]> min length constraint value({}) outside of buffer length!", m_buffer_size, f_min_length);
                 throw std::runtime_error("[Setup] StringField<char[N]> min length constraint value() outside of buffer length!");
             }
         }
 
-        add_constraint([f_min_length](auto& f_self, const std::string& f_value) {
+        add_constraint([f_min_length](auto& f_self, std::string_view f_value) {
             if (f_value.length() < f_min_length) {
                 SERROR("Invalid string field \"{}\" value length! Min[{}]!", f_self.name_cstr(), f_min_length);
                 return false;
@@ -145,14 +214,14 @@ public:
     }
 
     StringField& max_length(u32 f_max_length) {
-        if constexpr (false == __is_same(std::string, _Type)) {
+        if constexpr (CIsBuffer) {
             if (f_max_length > (m_buffer_size - 1U)) {
                 SERROR_LOCAL_T("[Setup] StringField<char[{}]> max length constraint value({}) outside of buffer length!", m_buffer_size, f_max_length);
                 throw std::runtime_error("[Setup] StringField<char[N]> max length constraint value() outside of buffer length!");
             }
         }
 
-        add_constraint([f_max_length](auto& f_self, const std::string& f_value) {
+        add_constraint([f_max_length](auto& f_self, std::string_view f_value) {
             if (f_value.length() > f_max_length) {
                 SERROR("Invalid string field \"{}\" value length! Max[{}]!", f_self.name_cstr(), f_max_length);
                 return false;
@@ -163,18 +232,18 @@ public:
     }
 
     //! Set post load handler
-    //! \remark (Field& f_self, const std::string& f_value) -> bool
+    //! \remark (Field& f_self, const std::string& f_value) -> bool, or (Field& f_self, std::string_view f_value) -> bool
     template <CStringFieldPostLoadFunctor _Functor>
     StringField& post_load(_Functor&& f_functor) {
-        m_post_load = std::forward<_Functor>(f_functor);
+        m_post_load = adapt_value_functor(std::forward<_Functor>(f_functor));
         return *this;
     }
 
     //! Set post load handler
-    //! \remark (Field& f_self, const std::string& f_value) static -> bool
+    //! \remark (Field& f_self, const std::string& f_value) static -> bool, or (Field& f_self, std::string_view f_value) static -> bool
     template <CStringFieldPostLoadFunctor _Functor>
     StringField& post_load() {
-        m_post_load = &_Functor::operator();
+        m_post_load = adapt_value_functor(&_Functor::operator());
         return *this;
     }
 
@@ -197,18 +266,20 @@ public:
     }
 
     //! Add custom constraint
-    //! \remark (Field& f_self, const std::string& f_value) -> bool
+    //! \remark (Field& f_self, const std::string& f_value) -> bool, or (Field& f_self, std::string_view f_value) -> bool
+    //! \remark The std::string_view form does not copy the value of char[N] fields
     template <CStringFieldConstraintFunctor _Functor>
     StringField& add_constraint(_Functor&& f_functor) {
-        m_constraints.emplace_back(std::forward<_Functor&&>(f_functor));
+        m_constraints.emplace_back(adapt_value_functor(std::forward<_Functor&&>(f_functor)));
         return *this;
     }
 
     //! Add custom constraint
-    //! \remark (Field& f_self, const std::string& f_value) -> bool
+    //! \remark (Field& f_self, const std::string& f_value) -> bool, or (Field& f_self, std::string_view f_value) -> bool
+    //! \remark The std::string_view form does not copy the value of char[N] fields
     template <CStringFieldConstraintFunctor _Functor>
     StringField& add_constraint() {
-        m_constraints.emplace_back(&_Functor::operator());
+        m_constraints.emplace_back(adapt_value_functor(&_Functor::operator()));
         return *this;
     }
 
@@ -219,20 +290,21 @@ public:
     }
 
 protected:
-    void load(json& f_json) override {
+    void load(const json& f_json) override {
         if constexpr (_PartOfArray) {
             SKL_ASSERT(f_json.is_string());
-            m_value      = f_json.template get<std::string>();
+            m_value.emplace(json_string_view(f_json));
             m_is_default = false;
         } else {
-            const auto exists = f_json.contains(this->name());
+            const auto it     = f_json.find(this->name());
+            const auto exists = f_json.end() != it;
             if (exists) {
-                auto& json = f_json[this->name()];
+                const auto& json = *it;
                 if (json.is_string()) {
-                    m_value = json.template get<std::string>();
+                    m_value.emplace(json_string_view(json));
                 } else {
                     if (m_dump_if_not_string) {
-                        m_value = json.dump();
+                        m_value.emplace(json.dump());
                     } else {
                         SERROR_LOCAL_T("Field \"{}\" must be a string field!", this->path_name().c_str());
                         throw std::runtime_error("String field doesnt have a string value!");
@@ -254,7 +326,7 @@ protected:
                 }
 
                 if (m_default.has_value()) {
-                    m_value      = m_default.value();
+                    m_value.emplace(m_default.value());
                     m_is_default = true;
                 } else {
                     SERROR_LOCAL_T("Non required string field \"{}\" has no default value!", this->path_name().c_str());
@@ -299,21 +371,41 @@ protected:
             }
 
             f_config.*m_member_ptr = m_value.value();
-        } else {
-            SKL_ASSERT(m_buffer_size > 1U);
-            if ((false == m_truncate_to_buffer) && ((m_buffer_size - 1U) < m_value->length())) {
-                SERROR_LOCAL_T("StringField<char[{}]> \"{}\" value read overruns the target buffer!\n\tvalue->\"{}\"", m_buffer_size, this->path_name().c_str(), skl_string_view::from_std(std::string_view{m_value.value()}));
-                throw std::runtime_error("StringField<char[N]> value read overruns the target buffer!");
+        } else if constexpr (CIsInterned) {
+            auto* arena = this->string_arena();
+            if (nullptr == arena) {
+                SERROR_LOCAL_T("StringField<std::string_view> \"{}\" has no string arena, see ConfigNode::intern_strings()!", this->path_name().c_str());
+                throw std::runtime_error("StringField<std::string_view> has no string arena!");
             }
 
             if (m_pre_submit.has_value()) {
                 if (false == m_pre_submit.value()(*this, m_value.value(), f_config)) {
+                    SERROR_LOCAL_T("StringField<std::string_view> \"{}\" pre_submit handler failed!", this->path_name().c_str());
+                    throw std::runtime_error("StringField<std::string_view> pre_submit handler failed!");
+                }
+            }
+
+            f_config.*m_member_ptr = arena->intern(m_value.value());
+        } else {
+            SKL_ASSERT(m_buffer_size > 1U);
+            if (m_pre_submit.has_value()) {
+                // The handler edits a std::string, only allocated when one is set
+                std::string value{m_value->view()};
+                if (false == m_pre_submit.value()(*this, value, f_config)) {
                     SERROR_LOCAL_T("StringField<char[{}]> \"{}\" pre_submit handler failed!", m_buffer_size, this->path_name().c_str());
                     throw std::runtime_error("StringField<char[]> pre_submit handler failed!");
                 }
+
+                m_value->assign(value);
+            }
+
+            // Checked on the pre_submit result, a handler may shorten an over-long value
+            if ((false == m_truncate_to_buffer) && ((m_buffer_size - 1U) < m_value->length())) {
+                SERROR_LOCAL_T("StringField<char[{}]> \"{}\" value read overruns the target buffer!\n\tvalue->\"{}\"", m_buffer_size, this->path_name().c_str(), skl_string_view::from_std(m_value->view()));
+                throw std::runtime_error("StringField<char[N]> value read overruns the target buffer!");
             }
 
-            const auto length = std::string_view{m_value.value()}.copy(f_config.*m_member_ptr, m_buffer_size - 1U);
+            const auto length = m_value->view().copy(f_config.*m_member_ptr, m_buffer_size - 1U);
 
             (f_config.*m_member_ptr)[length]             = 0;
             (f_config.*m_member_ptr)[m_buffer_size - 1U] = 0;
@@ -321,13 +413,13 @@ protected:
     }
 
     void load_value_from_default_object(const _TargetConfig& f_config) override {
-        m_value              = f_config.*m_member_ptr;
+        load_value_from_target(f_config);
         m_is_default         = true;
         m_is_validation_only = false;
     }
 
     void load_value_for_validation_only(const _TargetConfig& f_config) override {
-        m_value              = f_config.*m_member_ptr;
+        load_value_from_target(f_config);
         m_is_validation_only = true;
         m_is_default         = false;
     }
@@ -336,8 +428,79 @@ protected:
         return std::make_unique<StringField<_Type, _TargetConfig, _PartOfArray>>(*this);
     }
 
+    void serialize(const _TargetConfig& f_config, JsonWriter& f_writer) const override {
+        f_writer.key(this->name());
+        serialize_value(f_config.*m_member_ptr, f_writer);
+    }
+
+    //! Write a value of this field as json
+    static void serialize_value(const _Type& f_value, JsonWriter& f_writer) {
+        if constexpr (CIsBuffer) {
+            (void)f_writer.value(std::string_view{f_value, ::strnlen(f_value, sizeof(_Type) - 1U)});
+        } else {
+            (void)f_writer.value(std::string_view{f_value});
+        }
+    }
+
+    void hash_schema(SchemaHasher& f_hasher) const override {
+        f_hasher.add_type<StringField<_Type, _TargetConfig, _PartOfArray>>();
+        f_hasher.add_string(this->name());
+        f_hasher.add(m_default.has_value());
+        if (m_default.has_value()) {
+            f_hasher.add_string(m_default.value());
+        }
+        f_hasher.add(m_buffer_size);
+        f_hasher.add(m_required);
+        f_hasher.add(m_validate_if_default);
+        f_hasher.add(m_truncate_to_buffer);
+        f_hasher.add(m_dump_if_not_string);
+        f_hasher.add(m_constraints.size());
+        f_hasher.add(m_post_load.has_value());
+        f_hasher.add(m_pre_submit.has_value());
+    }
+
+    void save_state(SnapshotWriter& f_writer) const override {
+        f_writer.write<bool>(m_value.has_value());
+        if (m_value.has_value()) {
+            f_writer.write_string(m_value.value());
+        }
+        f_writer.write(m_is_default);
+    }
+
+    void load_state(SnapshotReader& f_reader) override {
+        if (f_reader.read<bool>()) {
+            m_value.emplace(f_reader.read_string());
+        } else {
+            m_value = std::nullopt;
+        }
+        m_is_default         = f_reader.read<bool>();
+        m_is_validation_only = false;
+    }
+
+private:
+    void load_value_from_target(const _TargetConfig& f_config) {
+        if constexpr (CIsBuffer) {
+            const char* buffer = f_config.*m_member_ptr;
+            m_value.emplace(std::string_view{buffer, ::strnlen(buffer, m_buffer_size - 1U)});
+        } else {
+            m_value.emplace(f_config.*m_member_ptr);
+        }
+    }
+
+    //! Constraints and post load handlers of char[N] fields take a view, wrap the ones taking a const std::string&
+    template <typename _Functor>
+    [[nodiscard]] static auto adapt_value_functor(_Functor&& f_functor) {
+        if constexpr (CIsBuffer && (false == std::is_invocable_r_v<bool, std::decay_t<_Functor>&, Field&, std::string_view>)) {
+            return [functor = std::forward<_Functor>(f_functor)](Field& f_self, std::string_view f_value) mutable -> bool {
+                return std::invoke(functor, f_self, std::string{f_value});
+            };
+        } else {
+            return std::forward<_Functor>(f_functor);
+        }
+    }
+
 private:
-    std::optional<std::string>  m_value;
+    std::optional<value_t>      m_value;
     std::optional<std::string>  m_default;
     member_ptr_t                m_member_ptr;
     constraints_t               m_constraints;
@@ -0,0 +1,130 @@
+//!
+//! \file config_node_copy_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <skl_config>
+
+using namespace skl;
+
+namespace {
+struct Endpoint {
+    u16         port;
+    std::string host;
+};
+
+struct Service {
+    Endpoint              primary;
+    Endpoint              secondary;
+    std::vector<Endpoint> backups;
+};
+
+void load(ConfigNode<Service>& f_loader, std::string_view f_json, Service& f_out_config) {
+    f_loader.load_validate_and_submit_buffer(std::span<const u8>{reinterpret_cast<const u8*>(f_json.data()), f_json.size()}, f_out_config);
+}
+
+ConfigNode<Endpoint> make_endpoint() {
+    ConfigNode<Endpoint> endpoint;
+    endpoint.numeric<u16>("port", &Endpoint::port).min(1U);
+    endpoint.string("host", &Endpoint::host).default_value("localhost");
+    return endpoint;
+}
+
+constexpr std::string_view CServiceJson = R"({
+    "primary":   {"port": 80, "host": "a"},
+    "secondary": {"port": 81},
+    "backups":   [{"port": 90}, {"port": 91, "host": "b"}]
+})";
+} // namespace
+
+TEST(ConfigNodeCopyTests, ReusedSubSchemaLoadsEveryMember) {
+    const auto endpoint = make_endpoint();
+
+    ConfigNode<Service> loader;
+    loader.object("primary", &Service::primary, endpoint);
+    loader.object("secondary", &Service::secondary, endpoint);
+    loader.array<Endpoint>("backups", &Service::backups, endpoint);
+
+    Service service{};
+    load(loader, CServiceJson, service);
+
+    ASSERT_EQ(80U, service.primary.port);
+    ASSERT_EQ("a", service.primary.host);
+    ASSERT_EQ(81U, service.secondary.port);
+    ASSERT_EQ("localhost", service.secondary.host);
+    ASSERT_EQ(2ULL, service.backups.size());
+    ASSERT_EQ(91U, service.backups[1].port);
+    ASSERT_EQ("b", service.backups[1].host);
+}
+
+TEST(ConfigNodeCopyTests, CopyLoadsLikeTheOriginal) {
+    ConfigNode<Service> loader;
+    loader.object("primary", &Service::primary, make_endpoint());
+    loader.object("secondary", &Service::secondary, make_endpoint());
+    loader.array<Endpoint>("backups", &Service::backups, make_endpoint());
+
+    const auto copy     = loader;
+    auto       assigned = ConfigNode<Service>{};
+    assigned            = copy;
+
+    for (auto* node : {&loader, const_cast<ConfigNode<Service>*>(&copy), &assigned}) {
+        Service service{};
+        load(*node, CServiceJson, service);
+        ASSERT_EQ(80U, service.primary.port);
+        ASSERT_EQ(2ULL, service.backups.size());
+    }
+}
+
+TEST(ConfigNodeCopyTests, FieldReferenceConfiguresTheOriginalOnly) {
+    ConfigNode<Endpoint> original;
+    auto&                port = original.numeric<u16>("port", &Endpoint::port);
+    original.string("host", &Endpoint::host).default_value("localhost");
+
+    const auto copy = original;
+    port.max(10U);
+
+    ConfigNode<Service> strict;
+    strict.object("primary", &Service::primary, std::move(original));
+    strict.object("secondary", &Service::secondary, copy);
+    strict.array<Endpoint>("backups", &Service::backups, copy);
+
+    // The copy taken before max(10) still accepts 80
+    ConfigNode<Service> relaxed;
+    relaxed.object("primary", &Service::primary, copy);
+    relaxed.object("secondary", &Service::secondary, copy);
+    relaxed.array<Endpoint>("backups", &Service::backups, copy);
+
+    Service service{};
+    load(relaxed, CServiceJson, service);
+    ASSERT_EQ(80U, service.primary.port);
+
+    Service rejected{};
+    ASSERT_THROW(load(strict, CServiceJson, rejected), std::runtime_error);
+    ASSERT_EQ(0U, rejected.primary.port);
+}
+
+TEST(ConfigNodeCopyTests, CopyOfALoadedNodeIsIndependent) {
+    ConfigNode<Service> loader;
+    loader.object("primary", &Service::primary, make_endpoint());
+    loader.object("secondary", &Service::secondary, make_endpoint());
+    loader.array<Endpoint>("backups", &Service::backups, make_endpoint());
+
+    Service service{};
+    load(loader, CServiceJson, service);
+
+    // A failed load of the copy does not affect the original
+    auto    copy = loader;
+    Service rejected{};
+    ASSERT_THROW(load(copy, R"({"primary": {"port": 0}, "secondary": {"port": 1}, "backups": []})", rejected), std::runtime_error);
+
+    Service reloaded{};
+    load(loader, CServiceJson, reloaded);
+    ASSERT_EQ(80U, reloaded.primary.port);
+}
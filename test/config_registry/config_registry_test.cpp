@@ -0,0 +1,200 @@
+//!
+//! \file config_registry_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <skl_config>
+
+namespace {
+//! Names of the load steps, in the order they ran
+class LoadLog {
+public:
+    [[nodiscard]] std::function<void()> step(std::string f_name, bool f_fail = false) {
+        return [this, name = std::move(f_name), f_fail]() {
+            {
+                std::lock_guard guard{m_lock};
+                m_order.push_back(name);
+            }
+
+            if (f_fail) {
+                throw std::runtime_error(name + " failed");
+            }
+        };
+    }
+
+    [[nodiscard]] std::vector<std::string> order() const {
+        std::lock_guard guard{m_lock};
+        return m_order;
+    }
+
+    [[nodiscard]] u64 position(std::string_view f_name) const {
+        const auto order = this->order();
+        return static_cast<u64>(std::find(order.begin(), order.end(), f_name) - order.begin());
+    }
+
+private:
+    mutable std::mutex       m_lock;
+    std::vector<std::string> m_order;
+};
+
+[[nodiscard]] const skl::config::registry_entry_report_t& entry_report(const skl::ConfigRegistry& f_registry, std::string_view f_name) {
+    const auto& entries = f_registry.report().m_entries;
+    return *std::find_if(entries.begin(), entries.end(), [f_name](const auto& f_entry) { return f_name == f_entry.m_name; });
+}
+
+struct PortConfig {
+    u16 port;
+};
+} // namespace
+
+TEST(ConfigRegistryTests, DependenciesLoadFirst) {
+    skl::config::WorkStealingExecutor executor{4U};
+    LoadLog                           log;
+    skl::ConfigRegistry               registry;
+
+    // a -> b -> d, a -> c -> d, e independent
+    registry.add("d", log.step("d"), {"b", "c"})
+        .add("b", log.step("b"), {"a"})
+        .add("c", log.step("c"), {"a"})
+        .add("a", log.step("a"))
+        .add("e", log.step("e"));
+
+    registry.load_all(executor);
+
+    ASSERT_EQ(5ULL, log.order().size());
+    ASSERT_LT(log.position("a"), log.position("b"));
+    ASSERT_LT(log.position("a"), log.position("c"));
+    ASSERT_LT(log.position("b"), log.position("d"));
+    ASSERT_LT(log.position("c"), log.position("d"));
+
+    for (const auto& entry : registry.report().m_entries) {
+        ASSERT_TRUE(entry.m_loaded) << entry.m_name;
+        ASSERT_TRUE(entry.m_errors.empty()) << entry.m_name;
+    }
+}
+
+TEST(ConfigRegistryTests, CycleIsRejectedBeforeLoading) {
+    LoadLog             log;
+    skl::ConfigRegistry registry;
+    registry.add("a", log.step("a"), {"c"})
+        .add("b", log.step("b"), {"a"})
+        .add("c", log.step("c"), {"b"})
+        .add("free", log.step("free"));
+
+    ASSERT_THROW(registry.load_all(), std::runtime_error);
+    ASSERT_TRUE(log.order().empty());
+}
+
+TEST(ConfigRegistryTests, SelfDependencyIsACycle) {
+    LoadLog             log;
+    skl::ConfigRegistry registry;
+    registry.add("a", log.step("a"), {"a"});
+
+    ASSERT_THROW(registry.load_all(), std::runtime_error);
+    ASSERT_TRUE(log.order().empty());
+}
+
+TEST(ConfigRegistryTests, UnknownDependencyIsRejectedBeforeLoading) {
+    LoadLog             log;
+    skl::ConfigRegistry registry;
+    registry.add("a", log.step("a"))
+        .add("b", log.step("b"), {"a", "missing"});
+
+    ASSERT_THROW(registry.load_all(), std::runtime_error);
+    ASSERT_TRUE(log.order().empty());
+}
+
+TEST(ConfigRegistryTests, DuplicateNameIsRejected) {
+    LoadLog             log;
+    skl::ConfigRegistry registry;
+    registry.add("a", log.step("a"))
+        .add("a", log.step("a"));
+
+    ASSERT_THROW(registry.load_all(), std::runtime_error);
+    ASSERT_TRUE(log.order().empty());
+}
+
+TEST(ConfigRegistryTests, FailedDependencySkipsItsDependents) {
+    skl::config::WorkStealingExecutor executor{4U};
+    LoadLog                           log;
+    skl::ConfigRegistry               registry;
+
+    // a fails, b and c (transitively) are skipped, d still loads
+    registry.add("a", log.step("a", true))
+        .add("b", log.step("b"), {"a"})
+        .add("c", log.step("c"), {"b"})
+        .add("d", log.step("d"));
+
+    ASSERT_THROW(registry.load_all(executor), std::runtime_error);
+
+    auto order = log.order();
+    std::sort(order.begin(), order.end());
+    ASSERT_EQ((std::vector<std::string>{"a", "d"}), order);
+
+    const auto& a = entry_report(registry, "a");
+    ASSERT_FALSE(a.m_loaded);
+    ASSERT_FALSE(a.m_errors.empty());
+    ASSERT_EQ("a failed", a.m_errors.back());
+
+    for (const auto name : {"b", "c"}) {
+        const auto& skipped = entry_report(registry, name);
+        ASSERT_FALSE(skipped.m_loaded) << name;
+        ASSERT_EQ(0ULL, skipped.m_duration_ns) << name;
+        ASSERT_EQ(1ULL, skipped.m_errors.size()) << name;
+    }
+
+    ASSERT_TRUE(entry_report(registry, "d").m_loaded);
+}
+
+TEST(ConfigRegistryTests, CriticalPathIsTheLongestChain) {
+    skl::config::WorkStealingExecutor executor{4U};
+    skl::ConfigRegistry               registry;
+
+    const auto sleep_ms = [](u32 f_ms) {
+        return [f_ms]() { std::this_thread::sleep_for(std::chrono::milliseconds(f_ms)); };
+    };
+
+    registry.add("a", sleep_ms(30U))
+        .add("b", sleep_ms(30U), {"a"})
+        .add("c", sleep_ms(30U), {"b"})
+        .add("short", sleep_ms(1U), {"a"})
+        .add("free", sleep_ms(1U));
+
+    registry.load_all(executor);
+
+    const auto& report = registry.report();
+    ASSERT_EQ((std::vector<std::string>{"a", "b", "c"}), report.m_critical_path);
+    ASSERT_GE(report.m_sum_ns, report.m_critical_path_ns);
+    ASSERT_GE(report.m_wall_ns, report.m_critical_path_ns);
+}
+
+TEST(ConfigRegistryTests, LoadsConfigFiles) {
+    const auto directory = std::filesystem::temp_directory_path() / "skl_config_registry_test";
+    std::filesystem::create_directories(directory);
+    const auto file = (directory / "port.json").string();
+    std::ofstream{file} << R"({"port": 8080})";
+
+    skl::ConfigNode<PortConfig> loader;
+    loader.numeric<u16>("port", &PortConfig::port).min(1U);
+
+    PortConfig          config{};
+    skl::ConfigRegistry registry;
+    registry.add("port", loader, file, config);
+    registry.load_all();
+
+    ASSERT_EQ(8080U, config.port);
+
+    std::filesystem::remove_all(directory);
+}
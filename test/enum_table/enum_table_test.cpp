@@ -0,0 +1,110 @@
+//!
+//! \file enum_table_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+#include <skl_config>
+
+using namespace skl;
+
+namespace {
+enum class Color : u8 {
+    Red,
+    Green,
+    Blue,
+    Black,
+    White
+};
+
+//! Sparse, with negative values
+enum class Level : i32 {
+    Low    = -3,
+    Medium = 7,
+    High   = 20
+};
+
+struct Palette {
+    Color m_background;
+    Color m_foreground;
+    Level m_level;
+};
+
+ConfigNode<Palette> make_loader() {
+    ConfigNode<Palette> loader;
+    loader.enumeration<Color>("background", &Palette::m_background).min(Color::Green).max(Color::White).exclude(Color::Black);
+    loader.enumeration<Color>("foreground", &Palette::m_foreground).allowed(Color::Red).allowed(Color::Blue).default_value(Color::Blue);
+    loader.enumeration<Level>("level", &Palette::m_level).exclude(Level::High);
+    return loader;
+}
+
+void load(ConfigNode<Palette>& f_loader, std::string_view f_json, Palette& f_out_palette) {
+    f_loader.load_validate_and_submit_buffer(std::span<const u8>{reinterpret_cast<const u8*>(f_json.data()), f_json.size()}, f_out_palette);
+}
+} // namespace
+
+TEST(EnumTableTests, FindsEveryEnumeratorByName) {
+    using color_table_t = config::EnumTable<Color>;
+    using level_table_t = config::EnumTable<Level>;
+
+    static_assert(color_table_t::find("Blue") == Color::Blue);
+    static_assert(level_table_t::find("Low") == Level::Low);
+
+    for (u64 i = 0ULL; i < color_table_t::CCount; ++i) {
+        ASSERT_EQ(color_table_t::CValues[i], color_table_t::find(color_table_t::CNames[i]));
+        ASSERT_EQ(i, color_table_t::index_of(color_table_t::CValues[i]));
+    }
+
+    for (u64 i = 0ULL; i < level_table_t::CCount; ++i) {
+        ASSERT_EQ(level_table_t::CValues[i], level_table_t::find(level_table_t::CNames[i]));
+        ASSERT_EQ(i, level_table_t::index_of(level_table_t::CValues[i]));
+    }
+}
+
+TEST(EnumTableTests, RejectsUnknownNamesAndValues) {
+    using color_table_t = config::EnumTable<Color>;
+    using level_table_t = config::EnumTable<Level>;
+
+    for (const std::string_view name : {"", "blue", "Blu", "Bluee", "Purple", "Blue ", "Low"}) {
+        ASSERT_FALSE(color_table_t::find(name).has_value()) << name;
+    }
+
+    ASSERT_FALSE(color_table_t::index_of(static_cast<Color>(5)).has_value());
+    ASSERT_FALSE(level_table_t::index_of(static_cast<Level>(0)).has_value());
+    ASSERT_FALSE(level_table_t::index_of(static_cast<Level>(21)).has_value());
+}
+
+TEST(EnumTableTests, AllowedValuesAreLoaded) {
+    auto    loader = make_loader();
+    Palette palette{};
+    load(loader, R"({"background": "White", "level": "Low"})", palette);
+    ASSERT_EQ(Color::White, palette.m_background);
+    ASSERT_EQ(Color::Blue, palette.m_foreground);
+    ASSERT_EQ(Level::Low, palette.m_level);
+
+    load(loader, R"({"background": "Green", "foreground": "Red", "level": "Medium"})", palette);
+    ASSERT_EQ(Color::Green, palette.m_background);
+    ASSERT_EQ(Color::Red, palette.m_foreground);
+    ASSERT_EQ(Level::Medium, palette.m_level);
+}
+
+TEST(EnumTableTests, DisallowedValuesAreRejected) {
+    auto loader = make_loader();
+
+    for (const std::string_view json : {
+             R"({"background": "Black", "level": "Low"})",                       // excluded
+             R"({"background": "Red", "level": "Low"})",                         // below min
+             R"({"background": "Blue", "level": "High"})",                       // excluded, sparse enum
+             R"({"background": "Blue", "foreground": "Green", "level": "Low"})", // not allowed
+             R"({"background": "Purple", "level": "Low"})",                      // unknown name
+         }) {
+        Palette palette{};
+        ASSERT_THROW(load(loader, json, palette), std::runtime_error) << json;
+        ASSERT_EQ(Color::Red, palette.m_background) << json;
+    }
+}
@@ -0,0 +1,223 @@
+//!
+//! \file executor_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <skl_config>
+
+namespace {
+//! Run f_depth levels of f_width tasks, each level from inside the tasks of the previous one
+void run_nested(skl::config::Executor& f_executor, u32 f_depth, u32 f_width, std::atomic<u64>& f_leaves) {
+    std::vector<std::function<void()>> tasks;
+    for (u32 i = 0U; i < f_width; ++i) {
+        tasks.emplace_back([&f_executor, f_depth, f_width, &f_leaves]() noexcept {
+            if (1U == f_depth) {
+                f_leaves.fetch_add(1ULL, std::memory_order_relaxed);
+            } else {
+                run_nested(f_executor, f_depth - 1U, f_width, f_leaves);
+            }
+        });
+    }
+
+    f_executor.run(tasks);
+}
+
+struct Inner {
+    u32 m_value;
+};
+
+struct Middle {
+    std::vector<Inner> m_inners;
+};
+
+struct Outer {
+    std::vector<Middle> m_middles;
+};
+
+//! Errors collected on the calling thread by a load of f_json (values must be < 100)
+std::vector<std::string> load_errors(skl::config::Executor* f_executor, const std::string& f_json) {
+    skl::ConfigNode<Inner> inner;
+    inner.numeric<u32>("value", &Inner::m_value).max(99U);
+    skl::ConfigNode<Middle> middle;
+    middle.array<Inner>("inners", &Middle::m_inners, std::move(inner));
+    skl::ConfigNode<Outer> outer;
+    outer.array<Middle>("middles", &Outer::m_middles, std::move(middle));
+    outer.parallel(f_executor);
+
+    std::vector<std::string>      errors;
+    skl::config::DiagnosticsScope scope{errors};
+
+    Outer result{};
+    EXPECT_THROW(outer.load_validate_and_submit_buffer(std::span<const u8>{reinterpret_cast<const u8*>(f_json.data()), f_json.size()}, result), std::runtime_error);
+    return errors;
+}
+
+//! Path names seen by the validation of every Inner::m_value while loading f_json
+std::set<std::string> validated_paths(skl::config::Executor* f_executor, bool f_copy, const std::string& f_json) {
+    std::mutex            lock;
+    std::set<std::string> paths;
+
+    skl::ConfigNode<Inner> inner;
+    inner.numeric<u32>("value", &Inner::m_value).add_constraint([&lock, &paths](skl::config::Field& f_field, u32) {
+        std::lock_guard guard{lock};
+        paths.insert(f_field.path_name());
+        return true;
+    });
+    skl::ConfigNode<Middle> middle;
+    middle.array<Inner>("inners", &Middle::m_inners, std::move(inner));
+    skl::ConfigNode<Outer> outer;
+    outer.array<Middle>("middles", &Outer::m_middles, std::move(middle));
+    outer.parallel(f_executor);
+
+    auto  copy   = outer;
+    auto& loader = f_copy ? copy : outer;
+
+    Outer result{};
+    loader.load_validate_and_submit_buffer(std::span<const u8>{reinterpret_cast<const u8*>(f_json.data()), f_json.size()}, result);
+    return paths;
+}
+} // namespace
+
+TEST(ExecutorTests, RunExecutesEveryTaskOnce) {
+    skl::config::WorkStealingExecutor executor{4U};
+    ASSERT_EQ(4U, executor.concurrency());
+
+    std::vector<std::atomic<u32>>      counts(1000U);
+    std::vector<std::function<void()>> tasks;
+    for (auto& count : counts) {
+        tasks.emplace_back([&count]() noexcept { count.fetch_add(1U, std::memory_order_relaxed); });
+    }
+
+    executor.run(tasks);
+
+    for (const auto& count : counts) {
+        ASSERT_EQ(1U, count.load());
+    }
+}
+
+TEST(ExecutorTests, NestedRunCompletes) {
+    // More nested batches than workers, every waiting caller must help or this deadlocks
+    for (const u32 threads : {1U, 2U, 4U}) {
+        skl::config::WorkStealingExecutor executor{threads};
+        std::atomic<u64>                  leaves{0ULL};
+
+        run_nested(executor, 4U, 6U, leaves);
+
+        ASSERT_EQ(6ULL * 6ULL * 6ULL * 6ULL, leaves.load()) << "threads=" << threads;
+    }
+}
+
+TEST(ExecutorTests, ParallelForCoversTheRangeOnce) {
+    skl::config::WorkStealingExecutor executor{4U};
+
+    for (const u64 count : {0ULL, 1ULL, 7ULL, 1000ULL, 12345ULL}) {
+        std::vector<std::atomic<u32>> visits(count);
+        skl::config::parallel_for(executor, count, 16ULL, [&visits](u64 f_begin, u64 f_end) {
+            for (u64 i = f_begin; i < f_end; ++i) {
+                visits[i].fetch_add(1U, std::memory_order_relaxed);
+            }
+        });
+
+        for (const auto& visit : visits) {
+            ASSERT_EQ(1U, visit.load()) << "count=" << count;
+        }
+    }
+}
+
+TEST(ExecutorTests, ParallelForRethrowsTheLowestFailingChunk) {
+    skl::config::WorkStealingExecutor executor{4U};
+
+    std::mutex       lock;
+    std::vector<u64> failed_begins;
+    std::atomic<u64> visited{0ULL};
+
+    try {
+        skl::config::parallel_for(executor, 10000ULL, 100ULL, [&](u64 f_begin, u64 f_end) {
+            visited.fetch_add(f_end - f_begin, std::memory_order_relaxed);
+            if (f_begin >= 2000ULL) {
+                {
+                    std::lock_guard guard{lock};
+                    failed_begins.push_back(f_begin);
+                }
+                throw std::runtime_error(std::to_string(f_begin));
+            }
+        });
+        FAIL() << "parallel_for did not rethrow";
+    } catch (const std::runtime_error& error) {
+        ASSERT_FALSE(failed_begins.empty());
+        ASSERT_EQ(std::to_string(*std::min_element(failed_begins.begin(), failed_begins.end())), error.what());
+    }
+
+    // A failing chunk does not cancel the others
+    ASSERT_EQ(10000ULL, visited.load());
+}
+
+TEST(ExecutorTests, ParallelForRethrowsFromNestedCalls) {
+    skl::config::WorkStealingExecutor executor{4U};
+
+    // Only the chunk pair containing (13, 37) throws
+    ASSERT_THROW(skl::config::parallel_for(executor, 64ULL, 1ULL, [&executor](u64 f_begin, u64 f_end) {
+                     skl::config::parallel_for(executor, 64ULL, 1ULL, [f_begin, f_end](u64 f_inner_begin, u64 f_inner_end) {
+                         if ((f_begin <= 13ULL) && (13ULL < f_end) && (f_inner_begin <= 37ULL) && (37ULL < f_inner_end)) {
+                             throw std::logic_error("inner");
+                         }
+                     });
+                 }),
+                 std::logic_error);
+}
+
+TEST(ExecutorTests, PostedTasksFinishBeforeDestruction) {
+    std::atomic<u32> done{0U};
+    {
+        skl::config::WorkStealingExecutor executor{3U};
+        for (u32 i = 0U; i < 500U; ++i) {
+            executor.post([&done]() noexcept { done.fetch_add(1U, std::memory_order_relaxed); });
+        }
+    }
+
+    ASSERT_EQ(500U, done.load());
+}
+
+TEST(ExecutorTests, ParallelLoadReportsTheSequentialPathNames) {
+    std::string json = R"({"middles": [)";
+    for (u32 i = 0U; i < 2000U; ++i) {
+        json += (0U == i) ? "" : ",";
+        json += R"({"inners": [{"value": 1}, {"value": 2}]})";
+    }
+    json += "]}";
+
+    const std::set<std::string> expected{"__root__:middles[]:<object>:inners[]:<object>:value"};
+    ASSERT_EQ(expected, validated_paths(nullptr, false, json));
+    ASSERT_EQ(expected, validated_paths(nullptr, true, json));
+
+    skl::config::WorkStealingExecutor executor{4U};
+    ASSERT_EQ(expected, validated_paths(&executor, false, json));
+    ASSERT_EQ(expected, validated_paths(&executor, true, json));
+}
+
+TEST(ExecutorTests, ParallelLoadReportsChildErrorsOnTheCaller) {
+    std::string json = R"({"middles": [)";
+    for (u32 i = 0U; i < 2000U; ++i) {
+        json += (0U == i) ? "" : ",";
+        json += ((570U == i) || (1500U == i)) ? R"({"inners": [{"value": 1}, {"value": 500}]})" : R"({"inners": [{"value": 1}, {"value": 2}]})";
+    }
+    json += "]}";
+
+    const auto expected = load_errors(nullptr, json);
+    ASSERT_FALSE(expected.empty());
+
+    skl::config::WorkStealingExecutor executor{4U};
+    ASSERT_EQ(expected, load_errors(&executor, json));
+}
@@ -0,0 +1,59 @@
+//!
+//! \file explicit_instantiation_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include "listener_config.hpp"
+
+using namespace skl;
+using test_config::Listener;
+
+namespace {
+void load(ConfigNode<Listener>& f_loader, const std::string& f_json, Listener& f_out_config) {
+    f_loader.load_validate_and_submit_buffer(std::span<const u8>{reinterpret_cast<const u8*>(f_json.data()), f_json.size()}, f_out_config);
+}
+} // namespace
+
+TEST(ExplicitInstantiationTests, LoadsThroughTheInstantiatedTemplates) {
+    auto     loader = test_config::make_listener_loader();
+    Listener config{};
+    load(loader, R"({"port": 8443, "tls": true, "limits": {"max_connections": 512}})", config);
+
+    ASSERT_EQ(8443U, config.m_port);
+    ASSERT_EQ("localhost", config.m_host);
+    ASSERT_TRUE(config.m_tls);
+    ASSERT_EQ(512U, config.m_limits.m_max_connections);
+}
+
+TEST(ExplicitInstantiationTests, CopiedLoaderLoadsTheSameSchema) {
+    const auto original = test_config::make_listener_loader();
+    auto       loader   = original;
+    ASSERT_EQ(original.schema_fingerprint(), loader.schema_fingerprint());
+
+    Listener config{};
+    load(loader, R"({"port": 80, "host": "example", "limits": {}})", config);
+    ASSERT_EQ(80U, config.m_port);
+    ASSERT_EQ("example", config.m_host);
+    ASSERT_FALSE(config.m_tls);
+    ASSERT_EQ(64U, config.m_limits.m_max_connections);
+}
+
+TEST(ExplicitInstantiationTests, InvalidConfigIsRejected) {
+    auto     loader = test_config::make_listener_loader();
+    Listener config{.m_port = 1234U, .m_host = "unchanged", .m_tls = false, .m_limits = {.m_max_connections = 7U}};
+
+    ASSERT_THROW(load(loader, R"({"port": 0, "host": "example", "tls": true})", config), std::runtime_error);
+    ASSERT_THROW(load(loader, R"({"port": 80, "limits": {"max_connections": 0}})", config), std::runtime_error);
+
+    // Nothing is submitted from a rejected config
+    ASSERT_EQ(1234U, config.m_port);
+    ASSERT_EQ("unchanged", config.m_host);
+    ASSERT_FALSE(config.m_tls);
+    ASSERT_EQ(7U, config.m_limits.m_max_connections);
+}
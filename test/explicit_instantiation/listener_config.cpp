@@ -0,0 +1,24 @@
+//!
+//! \file listener_config
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include "listener_config.hpp"
+
+SKL_CONFIG_INSTANTIATE_TEMPLATES(test_config::Limits)
+SKL_CONFIG_INSTANTIATE_TEMPLATES(test_config::Listener)
+SKL_CONFIG_INSTANTIATE_TEMPLATE(skl::config::ObjectField<test_config::Limits, test_config::Listener>)
+
+namespace test_config {
+skl::ConfigNode<Listener> make_listener_loader() {
+    skl::ConfigNode<Limits> limits;
+    limits.numeric<u32>("max_connections", &Limits::m_max_connections).min(1U).default_value(64U);
+
+    skl::ConfigNode<Listener> loader;
+    loader.numeric<u16>("port", &Listener::m_port).min(1U);
+    loader.string("host", &Listener::m_host).default_value("localhost");
+    loader.boolean("tls", &Listener::m_tls).default_value(false);
+    loader.object<Limits>("limits", &Listener::m_limits, std::move(limits));
+    return loader;
+}
+} // namespace test_config
@@ -0,0 +1,32 @@
+//!
+//! \file listener_config
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+//! Schema header of the explicit instantiation test, every TU including it skips the config instantiations
+//!
+#pragma once
+
+#include <string>
+
+#include <skl_config>
+
+namespace test_config {
+struct Limits {
+    u32 m_max_connections;
+};
+
+struct Listener {
+    u16         m_port;
+    std::string m_host;
+    bool        m_tls;
+    Limits      m_limits;
+};
+
+//! The listener loader, built in the instantiation TU
+[[nodiscard]] skl::ConfigNode<Listener> make_listener_loader();
+} // namespace test_config
+
+SKL_CONFIG_EXTERN_TEMPLATES(test_config::Limits)
+SKL_CONFIG_EXTERN_TEMPLATES(test_config::Listener)
+SKL_CONFIG_EXTERN_TEMPLATE(skl::config::ObjectField<test_config::Limits, test_config::Listener>)
@@ -0,0 +1,134 @@
+//!
+//! \file lazy_field_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <skl_config>
+
+using namespace skl;
+
+namespace {
+struct Region {
+    u32         m_id;
+    std::string m_name;
+};
+
+struct Config {
+    u32                             m_version;
+    LazyConfig<Region>              m_primary;
+    LazyConfig<std::vector<Region>> m_regions;
+};
+
+ConfigNode<Region> make_region() {
+    ConfigNode<Region> region;
+    region.numeric<u32>("id", &Region::m_id).max(100U);
+    region.string("name", &Region::m_name).default_value("none");
+    return region;
+}
+
+ConfigNode<Config> make_loader(bool f_background) {
+    ConfigNode<Config> loader;
+    loader.numeric<u32>("version", &Config::m_version);
+    loader.lazy_object<Region>("primary", &Config::m_primary, make_region()).required(true).validate_in_background(f_background);
+    loader.lazy_array<Region>("regions", &Config::m_regions, make_region())
+        .min_length(1U)
+        .default_value({Region{.m_id = 1U, .m_name = "default"}})
+        .validate_in_background(f_background);
+    return loader;
+}
+
+void load(ConfigNode<Config>& f_loader, std::string_view f_json, Config& f_out_config) {
+    f_loader.load_validate_and_submit_buffer(std::span<const u8>{reinterpret_cast<const u8*>(f_json.data()), f_json.size()}, f_out_config);
+}
+} // namespace
+
+TEST(LazyFieldTests, ResolvedOnFirstAccess) {
+    auto   loader = make_loader(false);
+    Config config{};
+    load(loader, R"({"version": 2, "primary": {"id": 7}, "regions": [{"id": 1, "name": "a"}, {"id": 2}]})", config);
+
+    ASSERT_EQ(2U, config.m_version);
+    ASSERT_TRUE(config.m_primary.has_value());
+    ASSERT_FALSE(config.m_primary.is_resolved());
+    ASSERT_NE(0ULL, config.m_primary.fingerprint());
+
+    // Concurrent first accesses resolve once
+    std::vector<std::thread> threads;
+    for (u32 i = 0U; i < 4U; ++i) {
+        threads.emplace_back([&config]() { EXPECT_EQ(2ULL, config.m_regions->size()); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(7U, config.m_primary->m_id);
+    ASSERT_EQ("none", config.m_primary->m_name);
+    ASSERT_EQ("a", (*config.m_regions)[0].m_name);
+    ASSERT_TRUE(config.m_primary.errors().empty());
+}
+
+TEST(LazyFieldTests, DefaultValueIsUsedWhenAbsent) {
+    auto   loader = make_loader(false);
+    Config config{};
+    load(loader, R"({"version": 2, "primary": {"id": 7}})", config);
+
+    ASSERT_EQ(0ULL, config.m_regions.fingerprint());
+    ASSERT_EQ(1ULL, config.m_regions->size());
+    ASSERT_EQ("default", config.m_regions->front().m_name);
+}
+
+TEST(LazyFieldTests, InvalidSubtreeIsRejectedOnAccess) {
+    auto   loader = make_loader(false);
+    Config config{};
+    load(loader, R"({"version": 2, "primary": {"id": 700}, "regions": []})", config);
+
+    // The load succeeds, every access rethrows the same error
+    ASSERT_EQ(2U, config.m_version);
+    for (u32 i = 0U; i < 2U; ++i) {
+        ASSERT_THROW((void)config.m_primary.get(), std::runtime_error);
+        ASSERT_THROW((void)config.m_regions.get(), std::runtime_error);
+    }
+    ASSERT_FALSE(config.m_primary.errors().empty());
+}
+
+TEST(LazyFieldTests, WrongTypeIsRejectedOnLoad) {
+    auto   loader = make_loader(false);
+    Config config{};
+    ASSERT_THROW(load(loader, R"({"version": 2, "primary": [1]})", config), std::runtime_error);
+    ASSERT_THROW(load(loader, R"({"version": 2})", config), std::runtime_error);
+    ASSERT_EQ(0U, config.m_version);
+    ASSERT_FALSE(config.m_primary.has_value());
+}
+
+TEST(LazyFieldTests, BackgroundResolveFinishesOnTheExecutor) {
+    Config valid{};
+    Config invalid{};
+    {
+        config::WorkStealingExecutor executor{2U};
+        auto                         loader = make_loader(true);
+        loader.parallel(&executor);
+
+        load(loader, R"({"version": 1, "primary": {"id": 7}, "regions": [{"id": 3}]})", valid);
+        load(loader, R"({"version": 1, "primary": {"id": 700}, "regions": [{"id": 3}]})", invalid);
+
+        // The executor finishes the posted resolves before it is destroyed
+    }
+
+    ASSERT_TRUE(valid.m_primary.is_resolved());
+    ASSERT_TRUE(valid.m_regions.is_resolved());
+    ASSERT_EQ(7U, valid.m_primary->m_id);
+    ASSERT_EQ(3U, valid.m_regions->front().m_id);
+
+    ASSERT_TRUE(invalid.m_primary.is_resolved());
+    ASSERT_THROW((void)invalid.m_primary.get(), std::runtime_error);
+    ASSERT_EQ(3U, invalid.m_regions->front().m_id);
+}
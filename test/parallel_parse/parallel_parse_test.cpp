@@ -0,0 +1,125 @@
+//!
+//! \file parallel_parse_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <skl_config>
+
+using namespace skl;
+
+namespace {
+struct Item {
+    u32         m_id;
+    std::string m_name;
+};
+
+struct Document {
+    u32               m_version;
+    std::vector<Item> m_items;
+    std::string       m_tail;
+};
+
+//! Fresh config file per test
+class ParallelParseTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_file = (std::filesystem::temp_directory_path()
+                  / ("skl_config_parallel_parse_test_" + std::to_string(::getpid()) + "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".json"))
+                     .string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(m_file);
+    }
+
+    void write(const std::string& f_json) const {
+        std::ofstream{m_file, std::ios::trunc} << f_json;
+    }
+
+    //! Document with f_count items, the strings contain structural characters the scanner must skip
+    void write_items(u32 f_count) const {
+        std::string json = R"({"version": 3, /* comment ] */ "items": [)";
+        for (u32 i = 0U; i < f_count; ++i) {
+            json += (0U == i) ? "\n" : ",\n";
+            json += R"({"id": )" + std::to_string(i) + R"(, "name": "a]}\"[{)" + std::to_string(i % 7U) + "\"}";
+        }
+        write(json + R"(], "tail": "end"})");
+    }
+
+    [[nodiscard]] ConfigNode<Document> make_loader(bool f_parallel, bool f_streaming) {
+        ConfigNode<Item> item;
+        item.numeric<u32>("id", &Item::m_id).max(1'000'000U);
+        item.string("name", &Item::m_name);
+
+        ConfigNode<Document> loader;
+        loader.numeric<u32>("version", &Document::m_version);
+        auto& items = loader.array<Item>("items", &Document::m_items, std::move(item)).streaming(f_streaming);
+        if (f_parallel) {
+            (void)items.parallel_parse(&m_executor);
+        }
+        loader.string("tail", &Document::m_tail);
+        return loader;
+    }
+
+    void load(ConfigNode<Document>& f_loader, Document& f_out_document) const {
+        f_loader.load_validate_and_submit(skl_string_view::from_std(std::string_view{m_file}), f_out_document);
+    }
+
+    config::WorkStealingExecutor m_executor{4U};
+    std::string                  m_file;
+};
+} // namespace
+
+TEST_F(ParallelParseTests, MatchesTheSequentialLoad) {
+    write_items(20'000U);
+
+    Document expected{};
+    auto     sequential = make_loader(false, false);
+    load(sequential, expected);
+    ASSERT_EQ(20'000ULL, expected.m_items.size());
+
+    for (const bool streaming : {false, true}) {
+        Document document{};
+        auto     loader = make_loader(true, streaming);
+        load(loader, document);
+
+        ASSERT_EQ(3U, document.m_version);
+        ASSERT_EQ("end", document.m_tail);
+        ASSERT_EQ(expected.m_items.size(), document.m_items.size());
+        for (u64 i = 0ULL; i < expected.m_items.size(); ++i) {
+            ASSERT_EQ(expected.m_items[i].m_id, document.m_items[i].m_id) << "streaming=" << streaming;
+            ASSERT_EQ(expected.m_items[i].m_name, document.m_items[i].m_name) << "streaming=" << streaming;
+        }
+    }
+}
+
+TEST_F(ParallelParseTests, MalformedElementIsRejected) {
+    write(R"({"version": 1, "items": [{"id": 1, "name": "a"}, {"id": tru, "name": "b"}], "tail": "end"})");
+
+    Document document{};
+    auto     loader = make_loader(true, false);
+    ASSERT_THROW(load(loader, document), std::exception);
+    ASSERT_EQ(0U, document.m_version);
+    ASSERT_TRUE(document.m_items.empty());
+}
+
+TEST_F(ParallelParseTests, InvalidElementIsRejected) {
+    write(R"({"version": 1, "items": [{"id": 1, "name": "a"}, {"id": 2000000, "name": "b"}], "tail": "end"})");
+
+    for (const bool streaming : {false, true}) {
+        Document document{};
+        auto     loader = make_loader(true, streaming);
+        ASSERT_THROW(load(loader, document), std::runtime_error) << "streaming=" << streaming;
+        ASSERT_TRUE(document.m_items.empty());
+    }
+}
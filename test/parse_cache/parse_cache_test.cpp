@@ -0,0 +1,219 @@
+//!
+//! \file parse_cache_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <skl_config>
+
+using namespace skl;
+
+namespace {
+struct ServerConfig {
+    u16         port;
+    std::string host;
+    u32         workers;
+};
+
+//! Fresh cache directory and config file per test
+class ParseCacheTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_directory = std::filesystem::temp_directory_path()
+                    / ("skl_config_parse_cache_test_" + std::to_string(::getpid()) + "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(m_directory);
+        std::filesystem::create_directories(m_directory / "cache");
+        m_file = (m_directory / "server.json").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_directory);
+    }
+
+    void write(const std::string& f_json) const {
+        std::ofstream{m_file, std::ios::trunc} << f_json;
+    }
+
+    //! Rewrite the file keeping its previous mtime (and size, if \p f_json has the same length)
+    void write_keeping_mtime(const std::string& f_json) const {
+        const auto mtime = std::filesystem::last_write_time(m_file);
+        write(f_json);
+        std::filesystem::last_write_time(m_file, mtime);
+    }
+
+    [[nodiscard]] ConfigNode<ServerConfig> make_loader(bool f_with_workers = false) {
+        ConfigNode<ServerConfig> loader;
+        loader.numeric<u16>("port", &ServerConfig::port).add_constraint([this](config::Field&, u16) {
+            m_validations.fetch_add(1U, std::memory_order_relaxed);
+            return true;
+        });
+        loader.string("host", &ServerConfig::host).default_value("localhost");
+        if (f_with_workers) {
+            loader.numeric<u32>("workers", &ServerConfig::workers).default_value(4U);
+        }
+
+        loader.parse_cache(skl_string_view::from_std((m_directory / "cache").string()));
+        return loader;
+    }
+
+    //! Load the file, true if it was validated (a cache miss)
+    [[nodiscard]] bool load(ConfigNode<ServerConfig>& f_loader, ServerConfig& f_out_config) {
+        const auto before = m_validations.load();
+        f_loader.load_validate_and_submit(skl_string_view::from_std(m_file), f_out_config);
+        return before != m_validations.load();
+    }
+
+    std::filesystem::path m_directory;
+    std::string           m_file;
+    std::atomic<u32>      m_validations{0U};
+};
+} // namespace
+
+TEST_F(ParseCacheTests, SecondLoadIsAHit) {
+    write(R"({"port": 8080, "host": "example"})");
+    auto loader = make_loader();
+
+    ServerConfig first{};
+    ASSERT_TRUE(load(loader, first));
+
+    ServerConfig second{};
+    ASSERT_FALSE(load(loader, second));
+    ASSERT_EQ(8080U, second.port);
+    ASSERT_EQ("example", second.host);
+}
+
+TEST_F(ParseCacheTests, ContentChangeWithSameSizeAndMtimeMisses) {
+    write(R"({"port": 8080})");
+    auto         loader = make_loader();
+    ServerConfig config{};
+    ASSERT_TRUE(load(loader, config));
+
+    // Same size, same mtime, only the content hash differs
+    write_keeping_mtime(R"({"port": 9090})");
+    ASSERT_TRUE(load(loader, config));
+    ASSERT_EQ(9090U, config.port);
+}
+
+TEST_F(ParseCacheTests, SizeChangeMisses) {
+    write(R"({"port": 8080})");
+    auto         loader = make_loader();
+    ServerConfig config{};
+    ASSERT_TRUE(load(loader, config));
+
+    write_keeping_mtime(R"({"port": 80})");
+    ASSERT_TRUE(load(loader, config));
+    ASSERT_EQ(80U, config.port);
+}
+
+TEST_F(ParseCacheTests, MtimeChangeMisses) {
+    write(R"({"port": 8080})");
+    auto         loader = make_loader();
+    ServerConfig config{};
+    ASSERT_TRUE(load(loader, config));
+    ASSERT_FALSE(load(loader, config));
+
+    // Same content, newer mtime
+    std::filesystem::last_write_time(m_file, std::filesystem::last_write_time(m_file) + std::chrono::seconds{5});
+    ASSERT_TRUE(load(loader, config));
+    ASSERT_FALSE(load(loader, config));
+}
+
+TEST_F(ParseCacheTests, SchemaFingerprintMismatchMisses) {
+    write(R"({"port": 8080, "workers": 16})");
+
+    auto         loader = make_loader();
+    ServerConfig config{};
+    ASSERT_TRUE(load(loader, config));
+
+    // Another schema over the same file and cache directory must never reuse the entry
+    auto extended = make_loader(true);
+    ASSERT_NE(loader.schema_fingerprint(), extended.schema_fingerprint());
+
+    ServerConfig extended_config{};
+    ASSERT_TRUE(load(extended, extended_config));
+    ASSERT_EQ(16U, extended_config.workers);
+    ASSERT_FALSE(load(extended, extended_config));
+
+    // The first schema's entry was replaced, it misses too
+    ASSERT_TRUE(load(loader, config));
+}
+
+TEST_F(ParseCacheTests, CorruptEntryMisses) {
+    write(R"({"port": 8080})");
+    auto         loader = make_loader();
+    ServerConfig config{};
+    ASSERT_TRUE(load(loader, config));
+
+    for (const auto& entry : std::filesystem::directory_iterator{m_directory / "cache"}) {
+        std::fstream stream{entry.path(), std::ios::in | std::ios::out | std::ios::binary};
+        stream.seekp(-1, std::ios::end);
+        stream.put('\xFF');
+    }
+
+    ASSERT_TRUE(load(loader, config));
+    ASSERT_EQ(8080U, config.port);
+}
+
+TEST_F(ParseCacheTests, ConcurrentStoresLeaveOneValidEntry) {
+    static constexpr u64 CPayloadSize = 1024ULL * 1024ULL;
+
+    const config::ParseCache cache{(m_directory / "cache").string()};
+    const auto               file = skl_string_view::from_std(m_file);
+    const auto               key  = config::ParseCache::make_key(config::file_identity_t{.m_inode = 1ULL}, "source", 0ULL);
+
+    // Every hit, during and after the stores, must be one whole payload
+    const auto check_hit = [&cache, &file, &key]() {
+        std::vector<u8> payload;
+        if (false == cache.lookup(file, key, 1ULL, payload)) {
+            return false;
+        }
+
+        EXPECT_EQ(CPayloadSize, payload.size());
+        EXPECT_EQ(payload.size(), static_cast<u64>(std::count(payload.begin(), payload.end(), payload.front())));
+        return true;
+    };
+
+    std::atomic<bool>        done{false};
+    std::vector<std::thread> threads;
+    for (u8 i = 0U; i < 8U; ++i) {
+        threads.emplace_back([&cache, &file, &key, i]() {
+            const std::vector<u8> payload(CPayloadSize, i);
+            for (u32 j = 0U; j < 16U; ++j) {
+                cache.store(file, key, 1ULL, payload);
+            }
+        });
+    }
+
+    std::thread reader{[&done, &check_hit]() {
+        while (false == done.load()) {
+            (void)check_hit();
+        }
+    }};
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    done.store(true);
+    reader.join();
+
+    ASSERT_TRUE(check_hit());
+
+    // No temporary entries are left behind
+    u32 entries = 0U;
+    for ([[maybe_unused]] const auto& entry : std::filesystem::directory_iterator{m_directory / "cache"}) {
+        ++entries;
+    }
+    ASSERT_EQ(1U, entries);
+}
@@ -0,0 +1,115 @@
+//!
+//! \file path_filter_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <skl_config>
+
+using namespace skl;
+
+namespace {
+struct Endpoint {
+    u16         m_port;
+    std::string m_host;
+};
+
+struct Service {
+    u32                   m_workers;
+    std::string           m_name;
+    Endpoint              m_primary;
+    std::vector<Endpoint> m_backups;
+};
+
+//! Fresh config file per test
+class PathFilterTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_file = (std::filesystem::temp_directory_path()
+                  / ("skl_config_path_filter_test_" + std::to_string(::getpid()) + "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".json"))
+                     .string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(m_file);
+    }
+
+    void write(const std::string& f_json) const {
+        std::ofstream{m_file, std::ios::trunc} << f_json;
+    }
+
+    [[nodiscard]] static ConfigNode<Service> make_loader() {
+        ConfigNode<Endpoint> endpoint;
+        endpoint.numeric<u16>("port", &Endpoint::m_port).min(1U);
+        endpoint.string("host", &Endpoint::m_host).default_value("localhost");
+
+        ConfigNode<Service> loader;
+        loader.numeric<u32>("workers", &Service::m_workers).max(64U);
+        loader.string("name", &Service::m_name).min_length(1U);
+        loader.object("primary", &Service::m_primary, endpoint);
+        loader.array<Endpoint>("backups", &Service::m_backups, endpoint);
+        return loader;
+    }
+
+    void load(ConfigNode<Service>& f_loader, Service& f_out_service, const config::PathFilter& f_filter) const {
+        f_loader.load_validate_and_submit(skl_string_view::from_std(std::string_view{m_file}), f_out_service, f_filter);
+    }
+
+    std::string m_file;
+};
+} // namespace
+
+TEST_F(PathFilterTests, OnlySelectedMembersAreSubmitted) {
+    write(R"({"workers": 8, "name": "svc", "primary": {"port": 80, "host": "a"},
+              "backups": [{"port": 90, "host": "b"}, {"port": 91}], "junk": [1, {"x": "}]"}]})");
+
+    auto    loader = make_loader();
+    Service service{.m_workers = 1U, .m_name = "keep", .m_primary = {}, .m_backups = {}};
+    load(loader, service, config::PathFilter{"primary:port", "backups[]:host"});
+
+    ASSERT_EQ(1U, service.m_workers);
+    ASSERT_EQ("keep", service.m_name);
+    ASSERT_EQ(80U, service.m_primary.m_port);
+    ASSERT_TRUE(service.m_primary.m_host.empty());
+    ASSERT_EQ(2ULL, service.m_backups.size());
+    ASSERT_EQ(0U, service.m_backups[0].m_port);
+    ASSERT_EQ("b", service.m_backups[0].m_host);
+    ASSERT_EQ("localhost", service.m_backups[1].m_host);
+
+    // The filter does not stick to the loader
+    Service full{};
+    loader.load_validate_and_submit(skl_string_view::from_std(std::string_view{m_file}), full);
+    ASSERT_EQ(8U, full.m_workers);
+    ASSERT_EQ("a", full.m_primary.m_host);
+}
+
+TEST_F(PathFilterTests, UnselectedInvalidMembersAreSkipped) {
+    write(R"({"workers": 1000, "name": "", "primary": {"port": 80}, "backups": [], "junk": [1, 2, tru]})");
+
+    auto    loader = make_loader();
+    Service service{};
+    load(loader, service, config::PathFilter{"primary"});
+    ASSERT_EQ(80U, service.m_primary.m_port);
+    ASSERT_EQ("localhost", service.m_primary.m_host);
+    ASSERT_EQ(0U, service.m_workers);
+}
+
+TEST_F(PathFilterTests, SelectedInvalidMembersAreRejected) {
+    write(R"({"workers": 1000, "name": "svc", "primary": {"port": 0}, "backups": []})");
+
+    auto    loader = make_loader();
+    Service service{};
+    ASSERT_THROW(load(loader, service, config::PathFilter{"workers"}), std::runtime_error);
+    ASSERT_THROW(load(loader, service, config::PathFilter{"primary:port"}), std::runtime_error);
+    ASSERT_EQ(0U, service.m_workers);
+    ASSERT_EQ(0U, service.m_primary.m_port);
+}
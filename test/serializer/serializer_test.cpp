@@ -0,0 +1,129 @@
+//!
+//! \file serializer_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <skl_config>
+
+using namespace skl;
+
+namespace {
+enum class Mode : u8 {
+    Off,
+    Fast,
+    Safe
+};
+
+struct Endpoint {
+    u16         m_port;
+    std::string m_host;
+};
+
+struct Service {
+    u32                   m_workers;
+    double                m_ratio;
+    bool                  m_enabled;
+    Mode                  m_mode;
+    char                  m_tag[8];
+    std::string           m_motd;
+    Endpoint              m_primary;
+    std::vector<Endpoint> m_backups;
+    std::vector<u32>      m_ids;
+    u32                   m_slots[3];
+};
+
+ConfigNode<Service> make_loader() {
+    ConfigNode<Endpoint> endpoint;
+    endpoint.numeric<u16>("port", &Endpoint::m_port).min(1U);
+    endpoint.string("host", &Endpoint::m_host);
+
+    ConfigNode<Service> loader;
+    loader.numeric<u32>("workers", &Service::m_workers).max(64U);
+    loader.numeric<double>("ratio", &Service::m_ratio);
+    loader.boolean("enabled", &Service::m_enabled);
+    loader.enumeration<Mode>("mode", &Service::m_mode);
+    loader.string("tag", &Service::m_tag);
+    loader.string("motd", &Service::m_motd);
+    loader.object("primary", &Service::m_primary, endpoint);
+    loader.array<Endpoint>("backups", &Service::m_backups, endpoint);
+    loader.array_raw<u32>("ids", &Service::m_ids);
+    loader.c_array<u32, 3>("slots", &Service::m_slots);
+    return loader;
+}
+
+void load(ConfigNode<Service>& f_loader, std::string_view f_json, Service& f_out_service) {
+    f_loader.load_validate_and_submit_buffer(std::span<const u8>{reinterpret_cast<const u8*>(f_json.data()), f_json.size()}, f_out_service);
+}
+
+constexpr std::string_view CServiceJson = R"({
+    "workers": 8, "ratio": 0.25, "enabled": true, "mode": "Safe", "tag": "blue",
+    "motd": "line \"one\"\n\ttab \\ \u0001 end",
+    "primary": {"port": 80, "host": "a"},
+    "backups": [{"port": 90, "host": "b"}, {"port": 91, "host": "c"}],
+    "ids": [1, 2, 3], "slots": [7, 8, 9]
+})";
+} // namespace
+
+TEST(SerializerTests, RoundTripReloadsTheSameConfig) {
+    auto    loader = make_loader();
+    Service original{};
+    load(loader, CServiceJson, original);
+
+    const auto text = loader.to_json_string(original);
+    ASSERT_EQ(nlohmann::json::parse(CServiceJson), nlohmann::json::parse(text));
+
+    Service reloaded{};
+    load(loader, text, reloaded);
+    ASSERT_EQ(original.m_workers, reloaded.m_workers);
+    ASSERT_EQ(original.m_ratio, reloaded.m_ratio);
+    ASSERT_EQ(Mode::Safe, reloaded.m_mode);
+    ASSERT_STREQ("blue", reloaded.m_tag);
+    ASSERT_EQ(original.m_motd, reloaded.m_motd);
+    ASSERT_EQ(2ULL, reloaded.m_backups.size());
+    ASSERT_EQ("c", reloaded.m_backups[1].m_host);
+    ASSERT_EQ(original.m_ids, reloaded.m_ids);
+    ASSERT_EQ(9U, reloaded.m_slots[2]);
+}
+
+TEST(SerializerTests, WriterEscapesStrings) {
+    for (u32 length = 1U; length < 80U; ++length) {
+        for (u32 position = 0U; position < length; ++position) {
+            std::string value(length, 'a');
+            value[position] = (0U == (position % 3U)) ? '"' : ((1U == (position % 3U)) ? '\\' : '\x1f');
+
+            config::JsonWriter writer;
+            (void)writer.value(value);
+            ASSERT_EQ(value, nlohmann::json::parse(writer.view()));
+        }
+    }
+}
+
+TEST(SerializerTests, InvalidTargetDoesNotReload) {
+    auto    loader = make_loader();
+    Service service{};
+    load(loader, CServiceJson, service);
+
+    // Serialization writes the target as is, the reload validates it
+    service.m_workers = 1000U;
+    Service reloaded{};
+    ASSERT_THROW(load(loader, loader.to_json_string(service), reloaded), std::runtime_error);
+
+    // Non finite numbers are written as null, which is not a number
+    service.m_workers = 8U;
+    service.m_ratio   = std::nan("");
+    const auto json   = nlohmann::json::parse(loader.to_json_string(service));
+    ASSERT_TRUE(json["ratio"].is_null());
+    ASSERT_THROW(load(loader, json.dump(), reloaded), std::runtime_error);
+    ASSERT_EQ(0U, reloaded.m_workers);
+}
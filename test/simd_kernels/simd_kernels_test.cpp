@@ -0,0 +1,243 @@
+//!
+//! \file simd_kernels_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <skl_config>
+
+namespace {
+using skl::config::simd::level_t;
+
+constexpr level_t CLevels[] = {level_t::scalar, level_t::sse42, level_t::avx2, level_t::avx512};
+
+//! Covers every vector width (4, 8, 16, 32), their tails and more than two scalar blocks
+constexpr u64 CMaxLength = (skl::config::simd::CScalarBlock * 2ULL) + 37ULL;
+
+//! Offsets of the first checked value, unaligned starts shift the tails
+constexpr u64 CBegins[] = {0ULL, 1ULL, 3ULL, 17ULL};
+
+//! Every kernel test runs once per forced level, levels the CPU lacks are skipped
+class SimdKernelsTests : public ::testing::TestWithParam<level_t> {
+protected:
+    void SetUp() override {
+        m_previous = skl::config::simd::active_level();
+        if (GetParam() != skl::config::simd::set_active_level(GetParam())) {
+            (void)skl::config::simd::set_active_level(m_previous);
+            GTEST_SKIP() << "CPU lacks " << skl::config::simd::level_name(GetParam());
+        }
+    }
+
+    void TearDown() override {
+        (void)skl::config::simd::set_active_level(m_previous);
+    }
+
+private:
+    level_t m_previous{level_t::scalar};
+};
+
+//! Run the range kernel over \p f_values with one value replaced by \p f_bad at each position (and none)
+template <typename _Type>
+void check_out_of_range(std::vector<_Type> f_values, _Type f_min, _Type f_max, _Type f_bad) {
+    for (u64 length = 0ULL; length <= f_values.size(); ++length) {
+        for (const auto begin : CBegins) {
+            if (begin > length) {
+                continue;
+            }
+
+            for (u64 position = begin; position <= length; ++position) {
+                auto values = f_values;
+                if (position < length) {
+                    values[position] = f_bad;
+                }
+
+                const auto expected = skl::config::simd::find_out_of_range_scalar(values.data(), begin, length, f_min, f_max);
+                const auto actual   = skl::config::simd::find_out_of_range(values.data(), begin, length, f_min, f_max);
+                ASSERT_EQ(expected, actual) << "length=" << length << " begin=" << begin << " position=" << position;
+                ASSERT_EQ((position < length) ? position : length, actual);
+            }
+        }
+    }
+}
+
+template <typename _Type>
+void check_not_power_of_2(std::vector<_Type> f_values, _Type f_bad) {
+    for (u64 length = 0ULL; length <= f_values.size(); ++length) {
+        for (const auto begin : CBegins) {
+            if (begin > length) {
+                continue;
+            }
+
+            for (u64 position = begin; position <= length; ++position) {
+                auto values = f_values;
+                if (position < length) {
+                    values[position] = f_bad;
+                }
+
+                const auto expected = skl::config::simd::find_not_power_of_2_scalar(values.data(), begin, length);
+                const auto actual   = skl::config::simd::find_not_power_of_2(values.data(), begin, length);
+                ASSERT_EQ(expected, actual) << "length=" << length << " begin=" << begin << " position=" << position;
+                ASSERT_EQ((position < length) ? position : length, actual);
+            }
+        }
+    }
+}
+
+void check_json_escape(const std::string& f_text, char f_escaped) {
+    for (u64 length = 0ULL; length <= f_text.size(); ++length) {
+        for (const auto begin : CBegins) {
+            if (begin > length) {
+                continue;
+            }
+
+            for (u64 position = begin; position <= length; ++position) {
+                auto text = f_text;
+                if (position < length) {
+                    text[position] = f_escaped;
+                }
+
+                const auto expected = skl::config::simd::find_json_escape_scalar(text.data(), begin, length);
+                const auto actual   = skl::config::simd::find_json_escape(text.data(), begin, length);
+                ASSERT_EQ(expected, actual) << "length=" << length << " begin=" << begin << " position=" << position;
+                ASSERT_EQ((position < length) ? position : length, actual);
+            }
+        }
+    }
+}
+
+//! Random values in [f_min, f_max], including both bounds
+template <typename _Type>
+std::vector<_Type> make_in_range(_Type f_min, _Type f_max) {
+    std::mt19937_64    engine{42U};
+    std::vector<_Type> values(CMaxLength);
+    for (auto& value : values) {
+        if constexpr (__is_same(_Type, float)) {
+            value = std::uniform_real_distribution<float>{f_min, f_max}(engine);
+        } else {
+            value = std::uniform_int_distribution<_Type>{f_min, f_max}(engine);
+        }
+    }
+
+    values[1U] = f_min;
+    values[5U] = f_max;
+
+    return values;
+}
+
+template <typename _Type>
+std::vector<_Type> make_powers_of_2() {
+    std::mt19937_64    engine{42U};
+    std::vector<_Type> values(CMaxLength);
+    for (auto& value : values) {
+        value = _Type(1) << std::uniform_int_distribution<u32>{1U, (sizeof(_Type) * 8U) - 2U}(engine);
+    }
+
+    return values;
+}
+} // namespace
+
+TEST_P(SimdKernelsTests, OutOfRangeU32) {
+    // Above 2^31, signed compares would get these wrong
+    const auto values = make_in_range<u32>(0x7FFFFFF0U, 0xFFFFFFF0U);
+    check_out_of_range<u32>(values, 0x7FFFFFF0U, 0xFFFFFFF0U, 0x7FFFFFEFU);
+    check_out_of_range<u32>(values, 0x7FFFFFF0U, 0xFFFFFFF0U, 0xFFFFFFF1U);
+    check_out_of_range<u32>(values, 0x7FFFFFF0U, 0xFFFFFFF0U, 0U);
+}
+
+TEST_P(SimdKernelsTests, OutOfRangeI32) {
+    const auto values = make_in_range<i32>(-1000, 1000);
+    check_out_of_range<i32>(values, -1000, 1000, -1001);
+    check_out_of_range<i32>(values, -1000, 1000, 1001);
+    check_out_of_range<i32>(values, -1000, 1000, std::numeric_limits<i32>::min());
+    check_out_of_range<i32>(values, -1000, 1000, std::numeric_limits<i32>::max());
+}
+
+TEST_P(SimdKernelsTests, OutOfRangeFloat) {
+    const auto values = make_in_range<float>(-1.5f, 2.5f);
+    check_out_of_range<float>(values, -1.5f, 2.5f, -1.5001f);
+    check_out_of_range<float>(values, -1.5f, 2.5f, 2.5001f);
+    check_out_of_range<float>(values, -1.5f, 2.5f, -std::numeric_limits<float>::infinity());
+    check_out_of_range<float>(values, -1.5f, 2.5f, std::numeric_limits<float>::infinity());
+}
+
+TEST_P(SimdKernelsTests, OutOfRangeFloatNaN) {
+    // NaN compares false against both bounds, every kernel lets it through like the scalar one
+    auto values = make_in_range<float>(-1.5f, 2.5f);
+    for (u64 i = 0ULL; i < values.size(); i += 3ULL) {
+        values[i] = std::numeric_limits<float>::quiet_NaN();
+    }
+
+    for (u64 length = 0ULL; length <= values.size(); ++length) {
+        ASSERT_EQ(length, skl::config::simd::find_out_of_range(values.data(), 0ULL, length, -1.5f, 2.5f)) << "length=" << length;
+    }
+
+    check_out_of_range<float>(values, -1.5f, 2.5f, 3.0f);
+}
+
+TEST_P(SimdKernelsTests, NotPowerOf2U32) {
+    auto values = make_powers_of_2<u32>();
+    values[3U]  = 0x80000000U; // Power of 2 for u32, negative as i32
+
+    check_not_power_of_2<u32>(values, 0U);
+    check_not_power_of_2<u32>(values, 1U);
+    check_not_power_of_2<u32>(values, 3U);
+    check_not_power_of_2<u32>(values, 0xC0000000U);
+    check_not_power_of_2<u32>(values, 0xFFFFFFFFU);
+}
+
+TEST_P(SimdKernelsTests, NotPowerOf2I32) {
+    const auto values = make_powers_of_2<i32>();
+    check_not_power_of_2<i32>(values, 0);
+    check_not_power_of_2<i32>(values, 1);
+    check_not_power_of_2<i32>(values, 6);
+    check_not_power_of_2<i32>(values, -2);
+    check_not_power_of_2<i32>(values, std::numeric_limits<i32>::min());
+}
+
+TEST_P(SimdKernelsTests, JsonEscape) {
+    // Printable ascii and utf-8 bytes (>= 0x80, negative as char) never need escaping
+    std::mt19937_64 engine{42U};
+    std::string     text(CMaxLength, ' ');
+    for (auto& c : text) {
+        const auto value = std::uniform_int_distribution<u32>{0x20U, 0xFFU}(engine);
+        c                = static_cast<char>((('"' == value) || ('\\' == value)) ? 0x7FU : value);
+    }
+
+    for (u64 i = 0ULL; i < CMaxLength; ++i) {
+        ASSERT_FALSE(skl::config::simd::needs_json_escape(text[i]));
+    }
+
+    for (const char escaped : {'\0', '\n', '\x1F', '"', '\\'}) {
+        check_json_escape(text, escaped);
+    }
+}
+
+TEST(SimdLevelTests, EnvironmentLowersTheDetectedLevel) {
+    const auto detected = skl::config::simd::detected_level();
+    const auto initial  = skl::config::simd::detail::initial_level();
+    ASSERT_LE(initial, detected);
+
+    // Set by the per-variant ctest registrations (see skl_AddConfigTest)
+    level_t     forced = detected;
+    const char* name   = std::getenv("SKL_CONFIG_SIMD");
+    if ((nullptr != name) && skl::config::simd::parse_level(name, forced)) {
+        ASSERT_EQ((forced < detected) ? forced : detected, initial);
+    } else {
+        ASSERT_EQ(detected, initial);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllLevels,
+                         SimdKernelsTests,
+                         ::testing::ValuesIn(CLevels),
+                         [](const ::testing::TestParamInfo<level_t>& f_info) {
+                             return std::string{skl::config::simd::level_name(f_info.param)};
+                         });
@@ -0,0 +1,115 @@
+//!
+//! \file source_format_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <skl_config>
+
+using namespace skl;
+
+namespace {
+struct Endpoint {
+    u16         m_port;
+    std::string m_host;
+};
+
+struct Service {
+    u32                   m_workers;
+    std::string           m_name;
+    std::vector<Endpoint> m_backups;
+};
+
+ConfigNode<Service> make_loader() {
+    ConfigNode<Endpoint> endpoint;
+    endpoint.numeric<u16>("port", &Endpoint::m_port).min(1U);
+    endpoint.string("host", &Endpoint::m_host).default_value("localhost");
+
+    ConfigNode<Service> loader;
+    loader.numeric<u32>("workers", &Service::m_workers).max(64U);
+    loader.string("name", &Service::m_name);
+    loader.array<Endpoint>("backups", &Service::m_backups, std::move(endpoint));
+    return loader;
+}
+
+std::string to_bytes(const std::vector<u8>& f_bytes) {
+    return std::string{f_bytes.begin(), f_bytes.end()};
+}
+
+//! The same document in every supported format, in SourceFormat order (Json first)
+std::vector<std::pair<config::SourceFormat, std::string>> encodings(const nlohmann::json& f_json) {
+    return {
+        {config::SourceFormat::Json, f_json.dump()},
+        {config::SourceFormat::Cbor, to_bytes(nlohmann::json::to_cbor(f_json))},
+        {config::SourceFormat::MessagePack, to_bytes(nlohmann::json::to_msgpack(f_json))},
+        {config::SourceFormat::Bson, to_bytes(nlohmann::json::to_bson(f_json))},
+    };
+}
+
+void load(ConfigNode<Service>& f_loader, std::string_view f_source, Service& f_out_service) {
+    f_loader.load_validate_and_submit_buffer(std::span<const u8>{reinterpret_cast<const u8*>(f_source.data()), f_source.size()}, f_out_service);
+}
+
+const nlohmann::json CValid   = nlohmann::json::parse(R"({"workers": 8, "name": "svc", "backups": [{"port": 90}, {"port": 91, "host": "b"}]})");
+const nlohmann::json CInvalid = nlohmann::json::parse(R"({"workers": 1000, "name": "svc", "backups": [{"port": 90}]})");
+} // namespace
+
+TEST(SourceFormatTests, DetectsEveryFormat) {
+    for (const auto& [format, source] : encodings(CValid)) {
+        ASSERT_EQ(format, config::detect_source_format(source));
+    }
+
+    ASSERT_EQ(config::SourceFormat::Json, config::detect_source_format("  {\"a\": 1}"));
+    ASSERT_EQ(config::SourceFormat::Json, config::detect_source_format("// comment\n{}"));
+}
+
+TEST(SourceFormatTests, EveryFormatLoadsTheSameConfig) {
+    for (const auto& [format, source] : encodings(CValid)) {
+        auto    loader = make_loader();
+        Service service{};
+        load(loader, source, service);
+
+        ASSERT_EQ(8U, service.m_workers);
+        ASSERT_EQ("svc", service.m_name);
+        ASSERT_EQ(2ULL, service.m_backups.size());
+        ASSERT_EQ("localhost", service.m_backups[0].m_host);
+        ASSERT_EQ(91U, service.m_backups[1].m_port);
+
+        // Explicit format
+        loader.source_format(format);
+        Service explicit_service{};
+        load(loader, source, explicit_service);
+        ASSERT_EQ("b", explicit_service.m_backups[1].m_host);
+    }
+}
+
+TEST(SourceFormatTests, InvalidConfigIsRejectedInEveryFormat) {
+    for (const auto& [format, source] : encodings(CInvalid)) {
+        auto    loader = make_loader();
+        Service service{};
+        ASSERT_THROW(load(loader, source, service), std::runtime_error) << static_cast<u32>(format);
+        ASSERT_EQ(0U, service.m_workers);
+    }
+}
+
+TEST(SourceFormatTests, WrongExplicitFormatIsRejected) {
+    const auto sources = encodings(CValid);
+
+    auto loader = make_loader();
+    loader.source_format(config::SourceFormat::Cbor);
+
+    Service service{};
+    ASSERT_ANY_THROW(load(loader, sources[0].second, service));
+    ASSERT_ANY_THROW(load(loader, sources[3].second, service));
+    ASSERT_EQ(0U, service.m_workers);
+}
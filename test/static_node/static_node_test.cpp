@@ -0,0 +1,109 @@
+//!
+//! \file static_node_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <skl_config>
+
+using namespace skl;
+using namespace skl::config;
+
+namespace {
+enum class Mode : u8 {
+    Off,
+    Fast,
+    Safe
+};
+
+struct NotReserved {
+    bool operator()(const std::string& f_value) const noexcept {
+        return "reserved" != f_value;
+    }
+};
+
+struct Endpoint {
+    u16         m_port;
+    std::string m_host;
+};
+
+struct Service {
+    u32                   m_workers;
+    float                 m_ratio;
+    bool                  m_enabled;
+    Mode                  m_mode;
+    char                  m_tag[8];
+    std::string           m_name;
+    Endpoint              m_primary;
+    std::vector<Endpoint> m_backups;
+    std::vector<u32>      m_ids;
+};
+
+using EndpointNode = StaticConfigNode<Endpoint,
+                                      schema::field<"port", &Endpoint::m_port, schema::min<1>, schema::required>,
+                                      schema::field<"host", &Endpoint::m_host, schema::default_string<"localhost">>>;
+
+using ServiceNode = StaticConfigNode<Service,
+                                     schema::field<"workers", &Service::m_workers, schema::max<64>, schema::required>,
+                                     schema::field<"ratio", &Service::m_ratio, schema::default_value<0.5f>>,
+                                     schema::field<"enabled", &Service::m_enabled, schema::default_value<false>>,
+                                     schema::field<"mode", &Service::m_mode, schema::default_value<Mode::Off>>,
+                                     schema::field<"tag", &Service::m_tag, schema::default_string<"none">>,
+                                     schema::field<"name", &Service::m_name, schema::required, schema::min<2>, schema::constraint<NotReserved>>,
+                                     schema::object<"primary", &Service::m_primary, EndpointNode, schema::required>,
+                                     schema::array<"backups", &Service::m_backups, EndpointNode, schema::min<1>>,
+                                     schema::field<"ids", &Service::m_ids, schema::max<4>>>;
+
+void load(std::string_view f_json, Service& f_out_service) {
+    ServiceNode node;
+    node.load_validate_and_submit_json(nlohmann::json::parse(f_json), f_out_service);
+}
+} // namespace
+
+TEST(StaticNodeTests, LoadsLikeTheRuntimeSchema) {
+    Service service{};
+    load(R"({"workers": 8, "enabled": true, "mode": "Safe", "tag": "blue", "name": "svc",
+             "primary": {"port": 80}, "backups": [{"port": 90, "host": "b"}], "ids": [1, 2, "3"]})",
+         service);
+
+    ASSERT_EQ(8U, service.m_workers);
+    ASSERT_EQ(0.5f, service.m_ratio);
+    ASSERT_TRUE(service.m_enabled);
+    ASSERT_EQ(Mode::Safe, service.m_mode);
+    ASSERT_STREQ("blue", service.m_tag);
+    ASSERT_EQ("svc", service.m_name);
+    ASSERT_EQ(80U, service.m_primary.m_port);
+    ASSERT_EQ("localhost", service.m_primary.m_host);
+    ASSERT_EQ(1ULL, service.m_backups.size());
+    ASSERT_EQ("b", service.m_backups[0].m_host);
+    ASSERT_EQ((std::vector<u32>{1U, 2U, 3U}), service.m_ids);
+}
+
+TEST(StaticNodeTests, InvalidConfigsAreRejected) {
+    for (const std::string_view json : {
+             R"({"workers": 100, "name": "svc", "primary": {"port": 80}, "backups": [{"port": 1}]})",                   // max
+             R"({"name": "svc", "primary": {"port": 80}, "backups": [{"port": 1}]})",                                   // required
+             R"({"workers": 1, "name": "reserved", "primary": {"port": 80}, "backups": [{"port": 1}]})",               // constraint
+             R"({"workers": 1, "name": "s", "primary": {"port": 80}, "backups": [{"port": 1}]})",                      // min length
+             R"({"workers": 1, "name": "svc", "primary": {"port": 0}, "backups": [{"port": 1}]})",                     // nested min
+             R"({"workers": 1, "name": "svc", "primary": {"port": 80}, "backups": []})",                               // array min
+             R"({"workers": 1, "name": "svc", "primary": {"port": 80}, "backups": [{"port": true}]})",                 // element type
+             R"({"workers": 1, "name": "svc", "primary": {"port": 80}, "backups": [{"port": 1}], "ids": [1,2,3,4,5]})", // array max
+             R"({"workers": 1, "name": "svc", "tag": "waytoolong", "primary": {"port": 80}, "backups": [{"port": 1}]})", // char[N] overrun
+             R"({"workers": 1, "name": "svc", "mode": "Slow", "primary": {"port": 80}, "backups": [{"port": 1}]})",    // unknown enum
+         }) {
+        Service service{};
+        service.m_workers = 77U;
+        ASSERT_THROW(load(json, service), std::runtime_error) << json;
+        ASSERT_EQ(77U, service.m_workers) << json;
+        ASSERT_TRUE(service.m_name.empty()) << json;
+    }
+}
@@ -0,0 +1,101 @@
+//!
+//! \file streaming_array_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <skl_config>
+
+using namespace skl;
+
+namespace {
+struct Entry {
+    u32 m_id;
+    u32 m_weight;
+};
+
+struct Config {
+    std::vector<Entry> m_entries;
+    std::vector<u32>   m_ids;
+};
+
+ConfigNode<Entry> make_entry() {
+    ConfigNode<Entry> entry;
+    entry.numeric<u32>("id", &Entry::m_id);
+    entry.numeric<u32>("weight", &Entry::m_weight).max(100U);
+    return entry;
+}
+
+ConfigNode<Config> make_loader() {
+    ConfigNode<Config> loader;
+    loader.array<Entry>("entries", &Config::m_entries, make_entry()).streaming(true).max_length(8U);
+    loader.array_raw<u32>("ids", &Config::m_ids).streaming(true);
+    return loader;
+}
+
+void load(ConfigNode<Config>& f_loader, std::string_view f_json, Config& f_out_config) {
+    f_loader.load_validate_and_submit_buffer(std::span<const u8>{reinterpret_cast<const u8*>(f_json.data()), f_json.size()}, f_out_config);
+}
+
+std::string entries_json(u32 f_count, u32 f_weight) {
+    std::string json = R"({"ids": [1, 2, 3], "entries": [)";
+    for (u32 i = 0U; i < f_count; ++i) {
+        json += (0U == i) ? "" : ",";
+        json += R"({"id": )" + std::to_string(i) + R"(, "weight": )" + std::to_string(f_weight) + "}";
+    }
+    return json + "]}";
+}
+} // namespace
+
+TEST(StreamingArrayTests, ElementsAreSubmittedInOrder) {
+    auto   loader = make_loader();
+    Config config{};
+    load(loader, entries_json(8U, 7U), config);
+
+    ASSERT_EQ(8ULL, config.m_entries.size());
+    for (u32 i = 0U; i < 8U; ++i) {
+        ASSERT_EQ(i, config.m_entries[i].m_id);
+        ASSERT_EQ(7U, config.m_entries[i].m_weight);
+    }
+    ASSERT_EQ((std::vector<u32>{1U, 2U, 3U}), config.m_ids);
+}
+
+TEST(StreamingArrayTests, OversizedArrayIsRejected) {
+    auto   loader = make_loader();
+    Config config{.m_entries = {Entry{.m_id = 42U, .m_weight = 1U}}, .m_ids = {}};
+
+    ASSERT_THROW(load(loader, entries_json(9U, 7U), config), std::runtime_error);
+    ASSERT_EQ(1ULL, config.m_entries.size());
+    ASSERT_EQ(42U, config.m_entries[0].m_id);
+}
+
+TEST(StreamingArrayTests, InvalidElementLeavesTheTargetUntouched) {
+    auto   loader = make_loader();
+    Config config{.m_entries = {Entry{.m_id = 42U, .m_weight = 1U}}, .m_ids = {}};
+
+    ASSERT_THROW(load(loader, entries_json(4U, 500U), config), std::runtime_error);
+    ASSERT_EQ(1ULL, config.m_entries.size());
+    ASSERT_EQ(42U, config.m_entries[0].m_id);
+    ASSERT_TRUE(config.m_ids.empty());
+}
+
+TEST(StreamingArrayTests, ElementsWithPostSubmitAreRejected) {
+    auto entry = make_entry();
+    entry.post_submit([](Entry&) { return true; });
+
+    ConfigNode<Config> loader;
+    auto&              entries = loader.array<Entry>("entries", &Config::m_entries, std::move(entry));
+    ASSERT_THROW((void)entries.streaming(true), std::runtime_error);
+
+    // Still usable without streaming
+    Config config{};
+    load(loader, R"({"entries": [{"id": 1, "weight": 2}]})", config);
+    ASSERT_EQ(1ULL, config.m_entries.size());
+}
@@ -0,0 +1,101 @@
+//!
+//! \file string_arena_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <skl_config>
+
+using namespace skl;
+
+namespace {
+struct Host {
+    std::string_view m_region;
+    std::string_view m_name;
+};
+
+struct Catalog {
+    std::vector<Host>             m_hosts;
+    std::vector<std::string_view> m_tags;
+    std::string_view              m_home;
+};
+
+ConfigNode<Catalog> make_loader() {
+    ConfigNode<Host> host;
+    host.string("region", &Host::m_region).min_length(2U);
+    host.string("name", &Host::m_name).default_value("unnamed");
+
+    ConfigNode<Catalog> loader;
+    loader.array<Host>("hosts", &Catalog::m_hosts, std::move(host));
+    loader.array_raw<std::string_view>("tags", &Catalog::m_tags);
+    loader.string("home", &Catalog::m_home);
+    return loader;
+}
+
+void load(ConfigNode<Catalog>& f_loader, std::string_view f_json, Catalog& f_out_catalog) {
+    f_loader.load_validate_and_submit_buffer(std::span<const u8>{reinterpret_cast<const u8*>(f_json.data()), f_json.size()}, f_out_catalog);
+}
+} // namespace
+
+TEST(StringArenaTests, EqualStringsShareOneCopy) {
+    config::StringArena arena{128U};
+    const auto          first  = arena.intern("eu-west");
+    const auto          second = arena.intern(std::string{"eu-west"});
+    const auto          large  = arena.intern(std::string(1000U, 'x'));
+
+    ASSERT_EQ("eu-west", first);
+    ASSERT_EQ(first.data(), second.data());
+    ASSERT_EQ(std::string(1000U, 'x'), large);
+    ASSERT_EQ(2ULL, arena.size());
+    ASSERT_EQ(3ULL, arena.requests());
+}
+
+TEST(StringArenaTests, SubmittedStringsAreInterned) {
+    config::StringArena arena{};
+    auto                loader = make_loader();
+    loader.intern_strings(&arena);
+
+    Catalog catalog{};
+    load(loader, R"({"home": "eu", "tags": ["eu", "us", "eu"],
+                     "hosts": [{"region": "eu", "name": "a"}, {"region": "us"}, {"region": "eu", "name": "a"}]})",
+         catalog);
+
+    ASSERT_EQ("eu", catalog.m_home);
+    ASSERT_EQ(3ULL, catalog.m_hosts.size());
+    ASSERT_EQ("unnamed", catalog.m_hosts[1].m_name);
+    ASSERT_EQ(catalog.m_home.data(), catalog.m_tags[0].data());
+    ASSERT_EQ(catalog.m_tags[0].data(), catalog.m_tags[2].data());
+    ASSERT_EQ(catalog.m_home.data(), catalog.m_hosts[2].m_region.data());
+    ASSERT_EQ(catalog.m_hosts[0].m_name.data(), catalog.m_hosts[2].m_name.data());
+    ASSERT_EQ(4ULL, arena.size()); // eu, us, a, unnamed
+
+    // A copy of the loader keeps interning into the same arena
+    auto    copy = loader;
+    Catalog other{};
+    load(copy, R"({"home": "eu", "tags": [], "hosts": []})", other);
+    ASSERT_EQ(catalog.m_home.data(), other.m_home.data());
+}
+
+TEST(StringArenaTests, InvalidValuesAreRejected) {
+    config::StringArena arena{};
+    auto                loader = make_loader();
+    loader.intern_strings(&arena);
+
+    Catalog catalog{};
+    ASSERT_THROW(load(loader, R"({"home": "eu", "tags": [], "hosts": [{"region": "e"}]})", catalog), std::runtime_error);
+    ASSERT_TRUE(catalog.m_home.empty());
+}
+
+TEST(StringArenaTests, LoaderWithoutArenaIsRejected) {
+    auto    loader = make_loader();
+    Catalog catalog{};
+    ASSERT_THROW(load(loader, R"({"home": "eu", "tags": [], "hosts": []})", catalog), std::runtime_error);
+    ASSERT_TRUE(catalog.m_home.empty());
+}
@@ -0,0 +1,94 @@
+//!
+//! \file string_buffer_test
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <skl_config>
+
+using namespace skl;
+
+namespace {
+struct Config {
+    char m_name[8];
+};
+
+void load(ConfigNode<Config>& f_loader, std::string_view f_json, Config& f_out_config) {
+    f_loader.load_validate_and_submit_buffer(std::span<const u8>{reinterpret_cast<const u8*>(f_json.data()), f_json.size()}, f_out_config);
+}
+} // namespace
+
+TEST(StringBufferTests, ValueIsDecodedIntoTheBuffer) {
+    ConfigNode<Config> loader;
+    loader.string("name", &Config::m_name);
+
+    Config config{};
+    load(loader, R"({"name": "abcdefg"})", config);
+    ASSERT_STREQ("abcdefg", config.m_name);
+
+    load(loader, R"({"name": "xy"})", config);
+    ASSERT_STREQ("xy", config.m_name);
+}
+
+TEST(StringBufferTests, OverrunIsRejected) {
+    ConfigNode<Config> loader;
+    loader.string("name", &Config::m_name);
+
+    Config config{};
+    std::strcpy(config.m_name, "keep");
+    ASSERT_THROW(load(loader, R"({"name": "abcdefgh"})", config), std::runtime_error);
+    ASSERT_STREQ("keep", config.m_name);
+}
+
+TEST(StringBufferTests, OverrunIsTruncatedWhenAllowed) {
+    ConfigNode<Config> loader;
+    loader.string("name", &Config::m_name).truncate_to_buffer(true);
+
+    Config config{};
+    load(loader, R"({"name": "abcdefghijkl"})", config);
+    ASSERT_STREQ("abcdefg", config.m_name);
+}
+
+TEST(StringBufferTests, ConstraintsSeeTheWholeValue) {
+    u64                length = 0ULL;
+    ConfigNode<Config> loader;
+    loader.string("name", &Config::m_name).truncate_to_buffer(true).add_constraint([&length](config::Field&, std::string_view f_value) {
+        length = f_value.length();
+        return true;
+    });
+
+    Config config{};
+    load(loader, R"({"name": "abcdefghijkl"})", config);
+    ASSERT_EQ(12ULL, length);
+}
+
+TEST(StringBufferTests, PreSubmitIsCheckedAgainstTheBuffer) {
+    // A handler shortening an over-long value saves it
+    ConfigNode<Config> shortening;
+    shortening.string("name", &Config::m_name).pre_submit([](config::Field&, std::string& f_value, Config&) {
+        f_value.resize(3U);
+        return true;
+    });
+
+    Config config{};
+    load(shortening, R"({"name": "abcdefghijkl"})", config);
+    ASSERT_STREQ("abc", config.m_name);
+
+    // A handler growing the value past the buffer is rejected, not truncated
+    ConfigNode<Config> growing;
+    growing.string("name", &Config::m_name).pre_submit([](config::Field&, std::string& f_value, Config&) {
+        f_value += "-suffix";
+        return true;
+    });
+
+    std::strcpy(config.m_name, "keep");
+    ASSERT_THROW(load(growing, R"({"name": "abc"})", config), std::runtime_error);
+    ASSERT_STREQ("keep", config.m_name);
+}
@@ -158,7 +158,7 @@ ConfigNode<MyConfigRoot>& get_config_loader() noexcept {
     // Alternative: Parse IPv4 from JSON string using JSON parser
     root.numeric<ipv4_addr_t>("ip_addr2", &MyConfigRoot::field_ip_addr)
         .required(true)
-        .parse_json<decltype([](config::Field& f_self, json& f_json) static -> std::optional<double> {
+        .parse_json<decltype([](config::Field& f_self, const json& f_json) static -> std::optional<double> {
             const auto result = ipv4_addr_from_str(f_json.get<std::string>().c_str());
             if (result == CIpAny) {
                 SERROR_LOCAL("Field \"{}\" must be a non-zero valid ip address!", f_self.path_name().c_str());